@@ -0,0 +1,263 @@
+#include "bench.h"
+#include "bench_environment.h"
+#include "logger.hpp"
+#include "utils/allocation_counter.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdlib>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <nlohmann/json.hpp>
+#include <string_view>
+#include <unordered_map>
+
+namespace bench {
+namespace {
+DECLARE_TAG(Bench)
+
+constexpr const char* kUsage =
+    "usage: SunnyLand-bench [--filter TEXT] [--min-time SECONDS] [--repetitions N] [--out FILE] [--baseline FILE]";
+// 校准迭代次数时的上限，防止被测代码被整体优化掉时无限放大
+constexpr uint64_t kMaxIterations = 1'000'000'000;
+
+struct Registration {
+  std::string name;
+  BenchmarkFunction function;
+  std::vector<std::vector<int64_t>> arg_sets;
+};
+
+struct Options {
+  std::string filter;
+  double min_time_s = 0.5;
+  uint32_t repetitions = 5;
+  std::string output_path;
+  std::string baseline_path;
+};
+
+struct Result {
+  std::string name;
+  uint64_t iterations = 0;
+  double ns_per_op = 0.0;
+  double ns_per_item = 0.0;
+  double allocs_per_op = 0.0;
+};
+
+std::vector<Registration>& GetRegistrations() {
+  static std::vector<Registration> registrations;
+  return registrations;
+}
+
+template <typename T>
+bool ParseNumber(std::string_view text, T& value) {
+  const auto result = std::from_chars(text.data(), text.data() + text.size(), value);
+  return result.ec == std::errc() && result.ptr == text.data() + text.size();
+}
+
+bool ParseOptions(int argc, char** argv, Options& options) {
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg = argv[i];
+    if (i + 1 >= argc) {
+      LOGE(TAG, "Missing value for argument '{}'. {}", arg, kUsage);
+      return false;
+    }
+    const std::string_view value = argv[++i];
+    if (arg == "--filter") {
+      options.filter = value;
+    } else if (arg == "--min-time") {
+      if (!ParseNumber(value, options.min_time_s) || options.min_time_s <= 0.0) {
+        LOGE(TAG, "Invalid min time '{}'. {}", value, kUsage);
+        return false;
+      }
+    } else if (arg == "--repetitions") {
+      if (!ParseNumber(value, options.repetitions) || options.repetitions == 0) {
+        LOGE(TAG, "Invalid repetitions '{}'. {}", value, kUsage);
+        return false;
+      }
+    } else if (arg == "--out") {
+      options.output_path = value;
+    } else if (arg == "--baseline") {
+      options.baseline_path = value;
+    } else {
+      LOGE(TAG, "Unknown argument '{}'. {}", arg, kUsage);
+      return false;
+    }
+  }
+  return true;
+}
+
+std::string GetInstanceName(const std::string& name, const std::vector<int64_t>& args) {
+  std::string instance_name = name;
+  for (const auto arg : args) {
+    instance_name += '/';
+    instance_name += std::to_string(arg);
+  }
+  return instance_name;
+}
+
+Result RunInstance(const Registration& registration, const std::vector<int64_t>& args, const Options& options) {
+  // 先把迭代次数放大到单次运行不短于 min_time，再用同样的次数重复测量取中位数
+  const double min_time_ns = options.min_time_s * 1e9;
+  uint64_t iterations = 1;
+  while (iterations < kMaxIterations) {
+    State state(iterations, args);
+    registration.function(state);
+    const auto elapsed_ns = static_cast<double>(state.GetElapsed().count());
+    if (elapsed_ns >= min_time_ns) {
+      break;
+    }
+    // 按当前速度估算，多留 40% 余量；每轮放大 2~10 倍
+    const double scale = elapsed_ns > 0.0 ? std::clamp(min_time_ns * 1.4 / elapsed_ns, 2.0, 10.0) : 10.0;
+    iterations = std::min(static_cast<uint64_t>(static_cast<double>(iterations) * scale), kMaxIterations);
+  }
+
+  std::vector<double> ns_per_op;
+  uint64_t allocations = 0;
+  uint64_t items_per_iteration = 1;
+  for (uint32_t i = 0; i < options.repetitions; ++i) {
+    State state(iterations, args);
+    registration.function(state);
+    ns_per_op.push_back(static_cast<double>(state.GetElapsed().count()) / static_cast<double>(iterations));
+    allocations += state.GetAllocations();
+    items_per_iteration = std::max<uint64_t>(state.GetItemsPerIteration(), 1);
+  }
+  std::sort(ns_per_op.begin(), ns_per_op.end());
+
+  Result result;
+  result.name = GetInstanceName(registration.name, args);
+  result.iterations = iterations;
+  result.ns_per_op = ns_per_op[ns_per_op.size() / 2];
+  result.ns_per_item = result.ns_per_op / static_cast<double>(items_per_iteration);
+  result.allocs_per_op =
+      static_cast<double>(allocations) / static_cast<double>(iterations * options.repetitions);
+  return result;
+}
+
+std::unordered_map<std::string, double> LoadBaseline(const std::string& path) {
+  std::unordered_map<std::string, double> baseline;
+  std::ifstream file(path);
+  if (!file.is_open()) {
+    LOGW(TAG, "Failed to open baseline file: {}", path);
+    return baseline;
+  }
+  try {
+    nlohmann::json json;
+    file >> json;
+    for (const auto& entry : json.at("benchmarks")) {
+      baseline[entry.at("name").get<std::string>()] = entry.at("ns_per_op").get<double>();
+    }
+  } catch (const nlohmann::json::exception& e) {
+    LOGW(TAG, "Failed to parse baseline file: {}! Error: {}", path, e.what());
+  }
+  return baseline;
+}
+
+bool WriteResults(const std::string& path, const std::vector<Result>& results) {
+  nlohmann::json benchmarks = nlohmann::json::array();
+  for (const auto& result : results) {
+    benchmarks.push_back({{"name", result.name},
+                          {"iterations", result.iterations},
+                          {"ns_per_op", result.ns_per_op},
+                          {"ns_per_item", result.ns_per_item},
+                          {"allocs_per_op", result.allocs_per_op}});
+  }
+  std::ofstream file(path);
+  if (!file.is_open()) {
+    LOGE(TAG, "Failed to open result file: {}", path);
+    return false;
+  }
+  file << nlohmann::json{{"benchmarks", benchmarks}}.dump(2) << '\n';
+  return file.good();
+}
+}  // namespace
+
+State::State(uint64_t iterations, const std::vector<int64_t>& args)
+    : iterations_(iterations), remaining_(iterations), args_(args) {
+}
+
+void State::Start() {
+  is_started_ = true;
+  ResumeTiming();
+}
+
+void State::Stop() {
+  PauseTiming();
+}
+
+void State::PauseTiming() {
+  if (!is_timing_) {
+    return;
+  }
+  elapsed_ += std::chrono::steady_clock::now() - start_time_;
+  allocations_ += engine::utils::AllocationCounter::GetCount() - start_allocations_;
+  is_timing_ = false;
+}
+
+void State::ResumeTiming() {
+  if (is_timing_) {
+    return;
+  }
+  is_timing_ = true;
+  start_allocations_ = engine::utils::AllocationCounter::GetCount();
+  start_time_ = std::chrono::steady_clock::now();
+}
+
+Registrar::Registrar(const char* name, BenchmarkFunction function,
+                     std::initializer_list<std::vector<int64_t>> arg_sets) {
+  GetRegistrations().push_back({name, function, arg_sets});
+}
+
+namespace detail {
+namespace {
+const void* volatile address_sink = nullptr;
+}  // namespace
+
+void UseAddress(const void* ptr) {
+  address_sink = ptr;
+}
+}  // namespace detail
+
+}  // namespace bench
+
+int main(int argc, char** argv) {
+  bench::Options options;
+  if (!bench::ParseOptions(argc, argv, options)) {
+    return EXIT_FAILURE;
+  }
+  // 被测路径上的调试日志会淹没结果，也会拖慢测量
+  spdlog::set_level(spdlog::level::warn);
+
+  try {
+    bench::BenchEnvironment environment;
+    const auto baseline = options.baseline_path.empty() ? std::unordered_map<std::string, double>{}
+                                                        : bench::LoadBaseline(options.baseline_path);
+    std::vector<bench::Result> results;
+    std::cout << std::format("{:<48} {:>12} {:>14} {:>12} {:>10} {:>10}\n", "benchmark", "iterations", "ns/op",
+                             "ns/item", "allocs/op", "vs base");
+    for (const auto& registration : bench::GetRegistrations()) {
+      for (const auto& args : registration.arg_sets) {
+        const std::string name = bench::GetInstanceName(registration.name, args);
+        if (!options.filter.empty() && name.find(options.filter) == std::string::npos) {
+          continue;
+        }
+        const auto result = bench::RunInstance(registration, args, options);
+        std::string versus_baseline = "-";
+        if (const auto it = baseline.find(result.name); it != baseline.end() && it->second > 0.0) {
+          versus_baseline = std::format("{:+.1f}%", (result.ns_per_op / it->second - 1.0) * 100.0);
+        }
+        std::cout << std::format("{:<48} {:>12} {:>14.1f} {:>12.2f} {:>10.2f} {:>10}\n", result.name,
+                                 result.iterations, result.ns_per_op, result.ns_per_item, result.allocs_per_op,
+                                 versus_baseline);
+        results.push_back(result);
+      }
+    }
+    if (!options.output_path.empty() && !bench::WriteResults(options.output_path, results)) {
+      return EXIT_FAILURE;
+    }
+  } catch (const std::exception& e) {
+    LOGE(bench::TAG, "Benchmark failed! Error: {}", e.what());
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,106 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+/**
+ * @brief 一次测量的状态。基准函数先做准备工作，再把被测代码放进 while (state.KeepRunning()) 循环；
+ * 第一次调用 KeepRunning 时开始计时。循环内的准备工作放在 PauseTiming/ResumeTiming 之间，不计时也不计分配。
+ * 计时区间内的堆分配次数会报告为 allocs/op。
+ */
+class State final {
+ public:
+  State(uint64_t iterations, const std::vector<int64_t>& args);
+
+  // 禁止拷贝和移动
+  State(const State&) = delete;
+  State& operator=(const State&) = delete;
+  State(State&&) = delete;
+  State& operator=(State&&) = delete;
+
+  bool KeepRunning() {
+    if (!is_started_) {
+      Start();
+    }
+    if (remaining_ > 0) {
+      --remaining_;
+      return true;
+    }
+    Stop();
+    return false;
+  }
+
+  void PauseTiming();
+  void ResumeTiming();
+
+  [[nodiscard]] int64_t Arg(size_t index) const {
+    return args_[index];
+  }
+  [[nodiscard]] uint64_t GetIterations() const {
+    return iterations_;
+  }
+
+  // 每次迭代处理的元素数（如一次绘制多少个精灵），报告里换算成每个元素的耗时
+  void SetItemsPerIteration(uint64_t items) {
+    items_per_iteration_ = items;
+  }
+
+  [[nodiscard]] std::chrono::nanoseconds GetElapsed() const {
+    return elapsed_;
+  }
+  [[nodiscard]] uint64_t GetAllocations() const {
+    return allocations_;
+  }
+  [[nodiscard]] uint64_t GetItemsPerIteration() const {
+    return items_per_iteration_;
+  }
+
+ private:
+  void Start();
+  void Stop();
+
+  uint64_t iterations_;
+  uint64_t remaining_;
+  const std::vector<int64_t>& args_;
+  uint64_t items_per_iteration_ = 1;
+  bool is_started_ = false;
+  bool is_timing_ = false;
+  std::chrono::steady_clock::time_point start_time_;
+  std::chrono::nanoseconds elapsed_{0};
+  uint64_t start_allocations_ = 0;
+  uint64_t allocations_ = 0;
+};
+
+using BenchmarkFunction = void (*)(State&);
+
+// 静态注册：每组参数单独测量，参数为空表示不带参数跑一次
+struct Registrar {
+  Registrar(const char* name, BenchmarkFunction function, std::initializer_list<std::vector<int64_t>> arg_sets = {{}});
+};
+
+namespace detail {
+void UseAddress(const void* ptr);
+}  // namespace detail
+
+// 阻止编译器把结果当作无用计算消掉
+template <typename T>
+inline void DoNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r"(&value) : "memory");
+#else
+  detail::UseAddress(&value);
+#endif
+}
+
+}  // namespace bench
+
+#define SUNNYLAND_BENCH_CONCAT_IMPL(a, b) a##b
+#define SUNNYLAND_BENCH_CONCAT(a, b) SUNNYLAND_BENCH_CONCAT_IMPL(a, b)
+// SUNNYLAND_BENCHMARK(名字, 函数, {参数...}, {参数...})
+#define SUNNYLAND_BENCHMARK(name, function, ...)                                     \
+  static const ::bench::Registrar SUNNYLAND_BENCH_CONCAT(bench_registrar_, __LINE__)( \
+      name, function __VA_OPT__(, {__VA_ARGS__}))
@@ -0,0 +1,108 @@
+#include "bench_environment.h"
+#include "core/config.h"
+#include "core/context.h"
+#include "core/job_system.h"
+#include "core/launch_options.h"
+#include "core/time.h"
+#include "input/input_manager.h"
+#include "logger.hpp"
+#include "render/camera.h"
+#include "render/renderer.h"
+#include "resource/resource_manager.h"
+#include "scene/scene_manager.h"
+
+#include <SDL3/SDL.h>
+#include <filesystem>
+#include <stdexcept>
+
+namespace bench {
+namespace {
+DECLARE_TAG(BenchEnvironment)
+BenchEnvironment* environment_instance = nullptr;
+}  // namespace
+
+BenchEnvironment::BenchEnvironment() {
+  SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "offscreen");
+  SDL_SetHint(SDL_HINT_AUDIO_DRIVER, "dummy");
+  if (!SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO)) {
+    throw std::runtime_error(std::string("Failed to initialize SDL: ") + SDL_GetError());
+  }
+  // 与游戏读取同一份配置，按键映射和窗口尺寸保持一致
+  config_ = std::make_unique<engine::core::Config>(engine::core::LaunchOptions{}.config_path);
+  sdl_window_ =
+      SDL_CreateWindow("SunnyLand-bench", config_->WindowWidth(), config_->WindowHeight(), SDL_WINDOW_HIDDEN);
+  if (sdl_window_ == nullptr) {
+    throw std::runtime_error(std::string("Failed to create window: ") + SDL_GetError());
+  }
+  sdl_renderer_ = SDL_CreateRenderer(sdl_window_, SDL_SOFTWARE_RENDERER);
+  if (sdl_renderer_ == nullptr) {
+    throw std::runtime_error(std::string("Failed to create renderer: ") + SDL_GetError());
+  }
+  const glm::vec2 logical_size(config_->WindowWidth() / 2.0f, config_->WindowHeight() / 2.0f);
+  SDL_SetRenderLogicalPresentation(sdl_renderer_, static_cast<int>(logical_size.x), static_cast<int>(logical_size.y),
+                                   SDL_LOGICAL_PRESENTATION_LETTERBOX);
+
+  time_ = std::make_unique<engine::core::Time>();
+  job_system_ = std::make_unique<engine::core::JobSystem>(static_cast<size_t>(config_->WorkerThreads()));
+  resource_manager_ = std::make_unique<engine::resource::ResourceManager>(sdl_renderer_);
+  renderer_ = std::make_unique<engine::render::Renderer>(sdl_renderer_, resource_manager_.get());
+  camera_ = std::make_unique<engine::render::Camera>(logical_size);
+  input_manager_ = std::make_unique<engine::input::InputManager>(sdl_renderer_, config_.get());
+  context_ = std::make_unique<engine::core::Context>(*input_manager_, *renderer_, *camera_, *resource_manager_,
+                                                     *time_, *job_system_);
+  scene_manager_ = std::make_unique<engine::scene::SceneManager>(*context_);
+  environment_instance = this;
+  LOGI(TAG, "Benchmark environment ready, renderer: {}", SDL_GetRendererName(sdl_renderer_));
+}
+
+BenchEnvironment::~BenchEnvironment() {
+  environment_instance = nullptr;
+  scene_manager_.reset();
+  context_.reset();
+  input_manager_.reset();
+  camera_.reset();
+  renderer_.reset();
+  // 纹理要在 SDL_Renderer 之前释放
+  resource_manager_.reset();
+  job_system_.reset();
+  if (sdl_renderer_ != nullptr) {
+    SDL_DestroyRenderer(sdl_renderer_);
+  }
+  if (sdl_window_ != nullptr) {
+    SDL_DestroyWindow(sdl_window_);
+  }
+  SDL_Quit();
+  std::error_code error;
+  for (const auto& path : texture_files_) {
+    std::filesystem::remove(path, error);
+  }
+}
+
+BenchEnvironment& BenchEnvironment::Get() {
+  if (environment_instance == nullptr) {
+    throw std::runtime_error("BenchEnvironment is not created");
+  }
+  return *environment_instance;
+}
+
+std::string BenchEnvironment::CreateTextureFile(const std::string& name, int width, int height) {
+  const std::string path = (std::filesystem::temp_directory_path() / ("sunnyland_bench_" + name + ".bmp")).string();
+  SDL_Surface* surface = SDL_CreateSurface(width, height, SDL_PIXELFORMAT_RGBA32);
+  if (surface == nullptr) {
+    throw std::runtime_error(std::string("Failed to create surface: ") + SDL_GetError());
+  }
+  // 用名字的哈希取色，不同纹理的像素不同
+  const auto hash = std::hash<std::string>{}(name);
+  SDL_FillSurfaceRect(surface, nullptr,
+                      SDL_MapSurfaceRGBA(surface, static_cast<Uint8>(hash), static_cast<Uint8>(hash >> 8),
+                                         static_cast<Uint8>(hash >> 16), 255));
+  const bool is_saved = SDL_SaveBMP(surface, path.c_str());
+  SDL_DestroySurface(surface);
+  if (!is_saved) {
+    throw std::runtime_error(std::string("Failed to save texture file: ") + SDL_GetError());
+  }
+  texture_files_.push_back(path);
+  return path;
+}
+
+}  // namespace bench
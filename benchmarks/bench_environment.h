@@ -0,0 +1,80 @@
+#pragma once
+#include <memory>
+#include <string>
+#include <vector>
+
+struct SDL_Window;
+struct SDL_Renderer;
+
+namespace engine::core {
+class Config;
+class Context;
+class JobSystem;
+class Time;
+}  // namespace engine::core
+
+namespace engine::input {
+class InputManager;
+}  // namespace engine::input
+
+namespace engine::render {
+class Camera;
+class Renderer;
+}  // namespace engine::render
+
+namespace engine::resource {
+class ResourceManager;
+}  // namespace engine::resource
+
+namespace engine::scene {
+class SceneManager;
+}  // namespace engine::scene
+
+namespace bench {
+
+/**
+ * @brief 基准测试共用的引擎环境，和 GameApp 的无头模式一样：offscreen 视频驱动 + 软件渲染器 + dummy 音频。
+ * 由 main 创建，存活期间可通过 Get() 访问；初始化失败时构造函数抛出 std::runtime_error。
+ */
+class BenchEnvironment final {
+ public:
+  BenchEnvironment();
+  ~BenchEnvironment();
+
+  // 禁止拷贝和移动
+  BenchEnvironment(const BenchEnvironment&) = delete;
+  BenchEnvironment& operator=(const BenchEnvironment&) = delete;
+  BenchEnvironment(BenchEnvironment&&) = delete;
+  BenchEnvironment& operator=(BenchEnvironment&&) = delete;
+
+  static BenchEnvironment& Get();
+
+  [[nodiscard]] SDL_Renderer* GetSDLRenderer() const {
+    return sdl_renderer_;
+  }
+  [[nodiscard]] engine::core::Context& GetContext() const {
+    return *context_;
+  }
+  [[nodiscard]] engine::scene::SceneManager& GetSceneManager() const {
+    return *scene_manager_;
+  }
+
+  // 在临时目录生成一张纯色 BMP 并返回路径，供需要按路径加载纹理的基准使用；环境析构时删除
+  std::string CreateTextureFile(const std::string& name, int width, int height);
+
+ private:
+  SDL_Window* sdl_window_{nullptr};
+  SDL_Renderer* sdl_renderer_{nullptr};
+  std::unique_ptr<engine::core::Config> config_{nullptr};
+  std::unique_ptr<engine::core::Time> time_{nullptr};
+  std::unique_ptr<engine::core::JobSystem> job_system_{nullptr};
+  std::unique_ptr<engine::resource::ResourceManager> resource_manager_{nullptr};
+  std::unique_ptr<engine::render::Renderer> renderer_{nullptr};
+  std::unique_ptr<engine::render::Camera> camera_{nullptr};
+  std::unique_ptr<engine::input::InputManager> input_manager_{nullptr};
+  std::unique_ptr<engine::core::Context> context_{nullptr};
+  std::unique_ptr<engine::scene::SceneManager> scene_manager_{nullptr};
+  std::vector<std::string> texture_files_;
+};
+
+}  // namespace bench
@@ -0,0 +1,50 @@
+#include "bench.h"
+#include "component/transform_component.h"
+#include "object/game_object.h"
+
+namespace bench {
+namespace {
+
+// 只用来占据组件表中不同位置的空组件
+template <int N>
+class PaddingComponent final : public engine::component::Component {
+ protected:
+  void Update(double, engine::core::Context&) override {
+  }
+};
+
+class MissingComponent final : public engine::component::Component {
+ protected:
+  void Update(double, engine::core::Context&) override {
+  }
+};
+
+void AddTypicalComponents(engine::object::GameObject& game_object) {
+  game_object.AddComponent<PaddingComponent<0>>();
+  game_object.AddComponent<PaddingComponent<1>>();
+  game_object.AddComponent<engine::component::TransformComponent>();
+  game_object.AddComponent<PaddingComponent<2>>();
+}
+
+void GetComponentHit(State& state) {
+  engine::object::GameObject game_object("bench_object");
+  AddTypicalComponents(game_object);
+  while (state.KeepRunning()) {
+    DoNotOptimize(game_object.GetComponent<engine::component::TransformComponent>());
+  }
+}
+
+void GetComponentMiss(State& state) {
+  engine::object::GameObject game_object("bench_object");
+  AddTypicalComponents(game_object);
+  while (state.KeepRunning()) {
+    DoNotOptimize(game_object.GetComponent<MissingComponent>());
+  }
+}
+
+}  // namespace
+
+SUNNYLAND_BENCHMARK("GameObject::GetComponent(hit)", GetComponentHit);
+SUNNYLAND_BENCHMARK("GameObject::GetComponent(miss)", GetComponentMiss);
+
+}  // namespace bench
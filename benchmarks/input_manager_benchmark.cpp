@@ -0,0 +1,29 @@
+#include "bench.h"
+#include "bench_environment.h"
+#include "core/context.h"
+#include "input/input_manager.h"
+
+namespace bench {
+namespace {
+
+// 组件每帧按动作名查询输入状态，默认配置里有这个动作
+void IsActionDownMapped(State& state) {
+  const auto& input_manager = BenchEnvironment::Get().GetContext().GetInputManager();
+  while (state.KeepRunning()) {
+    DoNotOptimize(input_manager.IsActionDown("move_left"));
+  }
+}
+
+void IsActionDownUnmapped(State& state) {
+  const auto& input_manager = BenchEnvironment::Get().GetContext().GetInputManager();
+  while (state.KeepRunning()) {
+    DoNotOptimize(input_manager.IsActionDown("bench_unmapped_action"));
+  }
+}
+
+}  // namespace
+
+SUNNYLAND_BENCHMARK("InputManager::IsActionDown(mapped)", IsActionDownMapped);
+SUNNYLAND_BENCHMARK("InputManager::IsActionDown(unmapped)", IsActionDownUnmapped);
+
+}  // namespace bench
@@ -0,0 +1,108 @@
+#include "bench.h"
+#include "bench_environment.h"
+#include "core/context.h"
+#include "render/camera.h"
+#include "render/renderer.h"
+#include "render/sprite.h"
+#include "resource/resource_manager.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace bench {
+namespace {
+constexpr int64_t kMaxTextureCount = 8;
+
+// 最多 kMaxTextureCount 种纹理的精灵，纹理文件只生成和加载一次
+const std::vector<engine::render::Sprite>& GetSprites() {
+  static const std::vector<engine::render::Sprite> sprites = [] {
+    auto& environment = BenchEnvironment::Get();
+    auto& resource_manager = environment.GetContext().GetResourceManager();
+    std::vector<engine::render::Sprite> result;
+    for (int64_t i = 0; i < kMaxTextureCount; ++i) {
+      const std::string path = environment.CreateTextureFile("sprite_" + std::to_string(i), 32, 32);
+      result.emplace_back(path);
+      result.back().SetTextureHandle(resource_manager.LoadTexture(path));
+    }
+    return result;
+  }();
+  return sprites;
+}
+
+// 精灵铺满视口，保证都通过视口裁剪
+glm::vec2 GetSpritePosition(const engine::render::Camera& camera, int64_t index) {
+  const glm::vec2 viewport = camera.GetViewportSize();
+  const auto columns = std::max<int64_t>(static_cast<int64_t>(viewport.x) / 8, 1);
+  return {static_cast<float>(index % columns) * 8.0f,
+          std::fmod(static_cast<float>(index / columns) * 8.0f, std::max(viewport.y, 1.0f))};
+}
+
+// 只录制命令：Arg(0) 个精灵、Arg(1) 种纹理交替出现
+void DrawSprite(State& state) {
+  auto& context = BenchEnvironment::Get().GetContext();
+  auto& renderer = context.GetRenderer();
+  const auto& camera = context.GetCamera();
+  const auto& sprites = GetSprites();
+  const int64_t sprite_count = state.Arg(0);
+  const int64_t texture_count = std::clamp<int64_t>(state.Arg(1), 1, kMaxTextureCount);
+  state.SetItemsPerIteration(static_cast<uint64_t>(sprite_count));
+  while (state.KeepRunning()) {
+    for (int64_t i = 0; i < sprite_count; ++i) {
+      renderer.DrawSprite(camera, sprites[i % texture_count], GetSpritePosition(camera, i));
+    }
+    state.PauseTiming();
+    // 丢弃录好的帧，不计入录制开销
+    renderer.EndFrame();
+    state.ResumeTiming();
+  }
+}
+
+// 完整一帧：清屏、录制、排序合批、软件渲染器回放并呈现
+void DrawSpriteAndPresent(State& state) {
+  auto& context = BenchEnvironment::Get().GetContext();
+  auto& renderer = context.GetRenderer();
+  const auto& camera = context.GetCamera();
+  const auto& sprites = GetSprites();
+  const int64_t sprite_count = state.Arg(0);
+  const int64_t texture_count = std::clamp<int64_t>(state.Arg(1), 1, kMaxTextureCount);
+  state.SetItemsPerIteration(static_cast<uint64_t>(sprite_count));
+  while (state.KeepRunning()) {
+    renderer.ClearScreen();
+    for (int64_t i = 0; i < sprite_count; ++i) {
+      renderer.DrawSprite(camera, sprites[i % texture_count], GetSpritePosition(camera, i));
+    }
+    renderer.Present();
+  }
+}
+
+// 完整一帧：Arg(0) 层双向平铺的视差背景，纹理边长 Arg(1)，纹理越小平铺块越多
+void DrawParallaxAndPresent(State& state) {
+  auto& environment = BenchEnvironment::Get();
+  auto& context = environment.GetContext();
+  auto& renderer = context.GetRenderer();
+  const auto& camera = context.GetCamera();
+  const auto texture_size = static_cast<int>(state.Arg(1));
+  const std::string path = environment.CreateTextureFile("parallax_" + std::to_string(texture_size), texture_size,
+                                                         texture_size);
+  engine::render::Sprite sprite(path);
+  sprite.SetTextureHandle(context.GetResourceManager().LoadTexture(path));
+  const int64_t layer_count = state.Arg(0);
+  state.SetItemsPerIteration(static_cast<uint64_t>(layer_count));
+  while (state.KeepRunning()) {
+    renderer.ClearScreen();
+    for (int64_t i = 0; i < layer_count; ++i) {
+      renderer.DrawParallax(camera, sprite, {static_cast<float>(i) * 13.0f, 0.0f}, {0.5f, 0.5f});
+    }
+    renderer.Present();
+  }
+}
+
+}  // namespace
+
+// {精灵数, 纹理种数}
+SUNNYLAND_BENCHMARK("Renderer::DrawSprite", DrawSprite, {100, 1}, {1000, 1}, {1000, 8});
+SUNNYLAND_BENCHMARK("Renderer::DrawSprite+Present", DrawSpriteAndPresent, {100, 1}, {1000, 1}, {1000, 8});
+// {层数, 纹理边长}
+SUNNYLAND_BENCHMARK("Renderer::DrawParallax+Present", DrawParallaxAndPresent, {3, 32}, {3, 176});
+
+}  // namespace bench
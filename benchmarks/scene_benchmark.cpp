@@ -0,0 +1,114 @@
+#include "bench.h"
+#include "bench_environment.h"
+#include "component/sprite_component.h"
+#include "component/transform_component.h"
+#include "core/context.h"
+#include "object/game_object.h"
+#include "render/renderer.h"
+#include "resource/resource_manager.h"
+#include "scene/scene.h"
+
+#include <deque>
+#include <random>
+
+namespace bench {
+namespace {
+
+class MoverComponent final : public engine::component::Component {
+  friend class engine::object::GameObject;
+
+ protected:
+  void Init() override {
+    transform_ = owner_->GetComponent<engine::component::TransformComponent>();
+  }
+  void Update(double delta_time_s, engine::core::Context&) override {
+    transform_->Translate(glm::vec2(static_cast<float>(delta_time_s), 0.0f));
+  }
+
+ private:
+  engine::component::TransformComponent* transform_ = nullptr;
+};
+
+std::unique_ptr<engine::object::GameObject> CreateObject(uint32_t index) {
+  auto game_object = std::make_unique<engine::object::GameObject>("object_" + std::to_string(index), "bench");
+  game_object->AddComponent<engine::component::TransformComponent>(glm::vec2(static_cast<float>(index), 0.0f));
+  game_object->AddComponent<MoverComponent>();
+  return game_object;
+}
+
+/**
+ * 场景里保持 Arg(0) 个对象，每帧移除最早加入的 Arg(1)‰ 个并补上同样数量的新对象。
+ * 新对象在暂停计时时创建，计时部分是组件更新、待移除对象的清理（含数组压缩）和待添加对象的合入。
+ */
+void SceneUpdate(State& state) {
+  const auto object_count = static_cast<uint32_t>(state.Arg(0));
+  const auto churn_count = static_cast<uint32_t>(state.Arg(0) * state.Arg(1) / 1000);
+  auto& environment = BenchEnvironment::Get();
+  engine::scene::Scene scene("bench_scene", environment.GetContext(), environment.GetSceneManager());
+  scene.Init();
+
+  std::deque<engine::object::GameObject*> live_objects;
+  uint32_t next_index = 0;
+  for (; next_index < object_count; ++next_index) {
+    auto game_object = CreateObject(next_index);
+    live_objects.push_back(game_object.get());
+    scene.AddGameObject(std::move(game_object));
+  }
+
+  state.SetItemsPerIteration(object_count);
+  while (state.KeepRunning()) {
+    if (churn_count > 0) {
+      state.PauseTiming();
+      for (uint32_t i = 0; i < churn_count; ++i) {
+        scene.SafeRemoveGameObject(live_objects.front());
+        live_objects.pop_front();
+        auto game_object = CreateObject(next_index++);
+        live_objects.push_back(game_object.get());
+        scene.SafeAddGameObject(std::move(game_object));
+      }
+      state.ResumeTiming();
+    }
+    scene.Update(1.0 / 60.0);
+  }
+  scene.Clean();
+}
+
+/**
+ * 场景里 Arg(0) 个精灵对象随机散布在 4096 见方的世界里，相机停在原点，只有少数落在视口内。
+ * 计时部分是可见性查询和组件录制渲染命令，录好的帧在暂停计时时丢弃。
+ */
+void SceneRender(State& state) {
+  auto& environment = BenchEnvironment::Get();
+  auto& context = environment.GetContext();
+  const std::string texture_path = environment.CreateTextureFile("scene_sprite", 16, 16);
+  engine::scene::Scene scene("bench_scene", context, environment.GetSceneManager());
+  scene.Init();
+
+  std::mt19937 random(42);
+  std::uniform_real_distribution<float> coordinate(0.0f, 4096.0f);
+  for (int64_t i = 0; i < state.Arg(0); ++i) {
+    auto game_object = std::make_unique<engine::object::GameObject>("sprite_" + std::to_string(i), "bench");
+    game_object->AddComponent<engine::component::TransformComponent>(glm::vec2(coordinate(random), coordinate(random)));
+    game_object->AddComponent<engine::component::SpriteComponent>(texture_path, context.GetResourceManager());
+    scene.AddGameObject(std::move(game_object));
+  }
+
+  state.SetItemsPerIteration(static_cast<uint64_t>(state.Arg(0)));
+  while (state.KeepRunning()) {
+    scene.Render();
+    state.PauseTiming();
+    context.GetRenderer().EndFrame();
+    state.ResumeTiming();
+  }
+  scene.Clean();
+}
+
+}  // namespace
+
+// {对象数, 每帧移除比例‰}
+SUNNYLAND_BENCHMARK("Scene::Update", SceneUpdate, {1000, 0}, {1000, 10}, {1000, 100}, {10000, 0}, {10000, 10},
+                    {10000, 100});
+// {对象数}
+SUNNYLAND_BENCHMARK("Scene::Render", SceneRender, {1000}, {10000});
+
+}  // namespace bench
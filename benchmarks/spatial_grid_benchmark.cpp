@@ -0,0 +1,79 @@
+#include "bench.h"
+#include "scene/spatial_grid.h"
+
+#include <random>
+
+namespace bench {
+namespace {
+constexpr float kWorldSize = 4096.0f;
+
+// 在 kWorldSize 见方的世界里随机放 count 个 16x16 的包围盒
+std::vector<engine::utils::Rect> MakeBounds(int64_t count) {
+  std::mt19937 random(42);
+  std::uniform_real_distribution<float> coordinate(0.0f, kWorldSize);
+  std::vector<engine::utils::Rect> bounds;
+  for (int64_t i = 0; i < count; ++i) {
+    bounds.push_back({{coordinate(random), coordinate(random)}, {16.0f, 16.0f}});
+  }
+  return bounds;
+}
+
+// 查询一个视口大小的区域，与逐个检查全部对象的线性扫描对比
+void SpatialGridQuery(State& state) {
+  engine::scene::SpatialGrid spatial_grid;
+  const auto bounds = MakeBounds(state.Arg(0));
+  for (const auto& rect : bounds) {
+    spatial_grid.Insert(nullptr, rect);
+  }
+  std::vector<engine::object::GameObject*> result;
+  float offset = 0.0f;
+  while (state.KeepRunning()) {
+    result.clear();
+    spatial_grid.Query({{offset, offset}, {320.0f, 180.0f}}, result);
+    DoNotOptimize(result.data());
+    offset = offset >= kWorldSize ? 0.0f : offset + 37.0f;
+  }
+}
+
+void LinearScanQuery(State& state) {
+  const auto bounds = MakeBounds(state.Arg(0));
+  std::vector<const engine::utils::Rect*> result;
+  float offset = 0.0f;
+  while (state.KeepRunning()) {
+    result.clear();
+    const engine::utils::Rect area{{offset, offset}, {320.0f, 180.0f}};
+    for (const auto& rect : bounds) {
+      if (rect.position.x <= area.position.x + area.size.x && area.position.x <= rect.position.x + rect.size.x &&
+          rect.position.y <= area.position.y + area.size.y && area.position.y <= rect.position.y + rect.size.y) {
+        result.push_back(&rect);
+      }
+    }
+    DoNotOptimize(result.data());
+    offset = offset >= kWorldSize ? 0.0f : offset + 37.0f;
+  }
+}
+
+// 所有对象每帧移动一小步，大部分不跨格
+void SpatialGridUpdate(State& state) {
+  engine::scene::SpatialGrid spatial_grid;
+  auto bounds = MakeBounds(state.Arg(0));
+  std::vector<uint32_t> proxies;
+  for (const auto& rect : bounds) {
+    proxies.push_back(spatial_grid.Insert(nullptr, rect));
+  }
+  state.SetItemsPerIteration(bounds.size());
+  while (state.KeepRunning()) {
+    for (size_t i = 0; i < bounds.size(); ++i) {
+      bounds[i].position.x = bounds[i].position.x >= kWorldSize ? 0.0f : bounds[i].position.x + 1.5f;
+      spatial_grid.Update(proxies[i], bounds[i]);
+    }
+  }
+}
+
+}  // namespace
+
+SUNNYLAND_BENCHMARK("SpatialGrid::Query", SpatialGridQuery, {1000}, {10000});
+SUNNYLAND_BENCHMARK("LinearScan::Query", LinearScanQuery, {1000}, {10000});
+SUNNYLAND_BENCHMARK("SpatialGrid::Update", SpatialGridUpdate, {10000});
+
+}  // namespace bench
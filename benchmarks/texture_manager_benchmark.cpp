@@ -0,0 +1,56 @@
+#include "bench.h"
+#include "bench_environment.h"
+#include "resource/texture_manager.h"
+
+#include <SDL3/SDL_surface.h>
+#include <stdexcept>
+
+namespace bench {
+namespace {
+
+// 往纹理管理器里放 count 张小图（会打进图集），返回它们的路径
+std::vector<std::string> AddTextures(engine::resource::TextureManager& texture_manager, int64_t count) {
+  std::vector<std::string> paths;
+  SDL_Surface* surface = SDL_CreateSurface(16, 16, SDL_PIXELFORMAT_RGBA32);
+  if (surface == nullptr) {
+    throw std::runtime_error(std::string("Failed to create surface: ") + SDL_GetError());
+  }
+  for (int64_t i = 0; i < count; ++i) {
+    paths.push_back("bench/textures/texture_" + std::to_string(i) + ".png");
+    texture_manager.AddTexture(paths.back(), surface);
+  }
+  SDL_DestroySurface(surface);
+  return paths;
+}
+
+// 按路径查找：哈希整条路径字符串再查表，是旧代码和按名字绘制的路径
+void GetTextureByPath(State& state) {
+  engine::resource::TextureManager texture_manager(BenchEnvironment::Get().GetSDLRenderer());
+  const auto paths = AddTextures(texture_manager, state.Arg(0));
+  size_t index = 0;
+  while (state.KeepRunning()) {
+    DoNotOptimize(texture_manager.GetTexture(paths[index]));
+    index = index + 1 == paths.size() ? 0 : index + 1;
+  }
+}
+
+// 按句柄查找：直接索引槽位并校验代数
+void GetTextureByHandle(State& state) {
+  engine::resource::TextureManager texture_manager(BenchEnvironment::Get().GetSDLRenderer());
+  std::vector<engine::resource::TextureHandle> handles;
+  for (const auto& path : AddTextures(texture_manager, state.Arg(0))) {
+    handles.push_back(texture_manager.LoadTexture(path));
+  }
+  size_t index = 0;
+  while (state.KeepRunning()) {
+    DoNotOptimize(texture_manager.GetTexture(handles[index]));
+    index = index + 1 == handles.size() ? 0 : index + 1;
+  }
+}
+
+}  // namespace
+
+SUNNYLAND_BENCHMARK("TextureManager::GetTexture(path)", GetTextureByPath, {16}, {1024});
+SUNNYLAND_BENCHMARK("TextureManager::GetTexture(handle)", GetTextureByHandle, {16}, {1024});
+
+}  // namespace bench
@@ -1,30 +1,178 @@
 #pragma once
 
 #include <spdlog/spdlog.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <format>
+#include <limits>
+#include <mutex>
+#include <vector>
 
 #define DECLARE_TAG(tag) constexpr char TAG[] = #tag;
 
-#define LOG_FORMAT_STR(fmt, ...) std::format(fmt __VA_OPT__(, ) __VA_ARGS__)
-#define LOG_PREFIX_STR(tag) LOG_FORMAT_STR("[{}][{}][{}][{}]", __FILE__, __LINE__, tag, __FUNCTION__)
+// 编译期最低日志级别，数值与 spdlog::level 一致。低于它的日志调用在编译期被丢弃，参数也不会求值
+#define SUNNYLAND_LOG_LEVEL_TRACE 0
+#define SUNNYLAND_LOG_LEVEL_DEBUG 1
+#define SUNNYLAND_LOG_LEVEL_INFO 2
+#define SUNNYLAND_LOG_LEVEL_WARN 3
+#define SUNNYLAND_LOG_LEVEL_ERROR 4
+#define SUNNYLAND_LOG_LEVEL_CRITICAL 5
+#define SUNNYLAND_LOG_LEVEL_OFF 6
+#ifndef SUNNYLAND_LOG_LEVEL
+#define SUNNYLAND_LOG_LEVEL SUNNYLAND_LOG_LEVEL_TRACE
+#endif
 
-#define LOGT(tag, msg, ...) spdlog::trace("{} {}", LOG_PREFIX_STR(tag), LOG_FORMAT_STR(msg __VA_OPT__(, ) __VA_ARGS__))
-#define LOGD(tag, msg, ...) spdlog::debug("{} {}", LOG_PREFIX_STR(tag), LOG_FORMAT_STR(msg __VA_OPT__(, ) __VA_ARGS__))
-#define LOGI(tag, msg, ...) spdlog::info("{} {}", LOG_PREFIX_STR(tag), LOG_FORMAT_STR(msg __VA_OPT__(, ) __VA_ARGS__))
-#define LOGW(tag, msg, ...) spdlog::warn("{} {}", LOG_PREFIX_STR(tag), LOG_FORMAT_STR(msg __VA_OPT__(, ) __VA_ARGS__))
-#define LOGE(tag, msg, ...) spdlog::error("{} {}", LOG_PREFIX_STR(tag), LOG_FORMAT_STR(msg __VA_OPT__(, ) __VA_ARGS__))
-#define LOGC(tag, msg, ...) \
-  spdlog::critical("{} {}", LOG_PREFIX_STR(tag), LOG_FORMAT_STR(msg __VA_OPT__(, ) __VA_ARGS__))
+namespace engine::utils {
+class LogRateLimiter;
+
+/**
+ * @brief 有待汇报的限流计数的调用点。只在调用点第一次丢弃日志时登记，平时的放行路径不加锁。
+ */
+class SuppressedLogRegistry final {
+ public:
+  static SuppressedLogRegistry& Instance() {
+    static SuppressedLogRegistry instance;
+    return instance;
+  }
+
+  void Add(LogRateLimiter* limiter) {
+    std::lock_guard lock(mutex_);
+    pending_.push_back(limiter);
+  }
+  // 汇报已过窗口的调用点的丢弃条数；force 为 true 时不论窗口全部汇报（退出前调用）
+  inline void Flush(bool force);
+
+ private:
+  SuppressedLogRegistry() = default;
+
+  std::mutex mutex_;
+  std::vector<LogRateLimiter*> pending_;
+};
+
+/**
+ * @brief 按调用点限流，所有级别都适用（例如每帧每个精灵都报的缺失纹理错误）。
+ * 每个日志宏展开处有一个静态实例，每个时间窗口最多放行 kBurst 条，其余只计数。
+ * 丢弃的条数随窗口滚动后的下一条日志汇报；调用点之后不再输出时，由 FlushSuppressedLogs 补报。
+ */
+class LogRateLimiter final {
+ public:
+  static constexpr int64_t kWindowNs = 1'000'000'000;
+  static constexpr uint32_t kBurst = 5;
+
+  LogRateLimiter(spdlog::level::level_enum level, const char* file_name, int line, const char* tag,
+                 const char* func_name)
+      : level_(level), file_name_(file_name), line_(line), tag_(tag), func_name_(func_name) {}
+  // 禁止拷贝和移动
+  LogRateLimiter(const LogRateLimiter&) = delete;
+  LogRateLimiter& operator=(const LogRateLimiter&) = delete;
+  LogRateLimiter(LogRateLimiter&&) = delete;
+  LogRateLimiter& operator=(LogRateLimiter&&) = delete;
+
+  // 放行返回 true，suppressed 为此前丢弃且尚未汇报的条数
+  bool Allow(uint32_t& suppressed) {
+    const int64_t now = NowNs();
+    int64_t window_start = window_start_ns_.load(std::memory_order_relaxed);
+    if (now - window_start >= kWindowNs &&
+        window_start_ns_.compare_exchange_strong(window_start, now, std::memory_order_relaxed)) {
+      count_.store(0, std::memory_order_relaxed);
+    }
+    if (count_.fetch_add(1, std::memory_order_relaxed) < kBurst) {
+      suppressed = suppressed_.exchange(0, std::memory_order_relaxed);
+      return true;
+    }
+    suppressed_.fetch_add(1, std::memory_order_relaxed);
+    if (!is_registered_.exchange(true, std::memory_order_acq_rel)) {
+      SuppressedLogRegistry::Instance().Add(this);
+    }
+    return false;
+  }
+
+  // 窗口已结束（或 force）时汇报并清零丢弃计数。返回 false 表示窗口未结束，需要留在登记表中
+  bool FlushSuppressed(bool force) {
+    if (!force && NowNs() - window_start_ns_.load(std::memory_order_relaxed) < kWindowNs) {
+      return false;
+    }
+    // 先撤销登记再取计数：之后新丢弃的日志会重新登记，不会漏报
+    is_registered_.store(false, std::memory_order_release);
+    const uint32_t suppressed = suppressed_.exchange(0, std::memory_order_relaxed);
+    if (suppressed > 0) {
+      spdlog::default_logger_raw()->log(
+          level_, std::format("[{}][{}][{}][{}] suppressed {} message(s) from this call site", file_name_, line_, tag_,
+                              func_name_, suppressed));
+    }
+    return true;
+  }
+
+ private:
+  static int64_t NowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+  }
+
+  std::atomic<int64_t> window_start_ns_{std::numeric_limits<int64_t>::min() / 2};
+  std::atomic<uint32_t> count_{0};
+  std::atomic<uint32_t> suppressed_{0};
+  std::atomic<bool> is_registered_{false};
+  spdlog::level::level_enum level_;
+  const char* file_name_;
+  int line_;
+  const char* tag_;
+  const char* func_name_;
+};
+
+void SuppressedLogRegistry::Flush(bool force) {
+  std::lock_guard lock(mutex_);
+  std::erase_if(pending_, [force](LogRateLimiter* limiter) { return limiter->FlushSuppressed(force); });
+}
+
+// 主循环每帧调用一次，补报安静下来的调用点丢弃的条数；退出前以 force = true 调用
+inline void FlushSuppressedLogs(bool force = false) {
+  SuppressedLogRegistry::Instance().Flush(force);
+}
+}  // namespace engine::utils
+
+// 先判断运行期级别和调用点限流再格式化，前缀和正文一次格式化成一个字符串。丢弃的条数不会丢失，随后汇报为
+// "suppressed N message(s)"。被编译期级别排除的调用仍会做类型检查（不会因此出现未使用变量的警告），但不生成任何代码
+#define LOG_IMPL(level, tag, msg, ...)                                                                         \
+  do {                                                                                                         \
+    if constexpr (static_cast<int>(level) >= SUNNYLAND_LOG_LEVEL) {                                            \
+      if (spdlog::default_logger_raw()->should_log(level)) {                                                   \
+        static ::engine::utils::LogRateLimiter log_rate_limiter(level, __FILE__, __LINE__, tag, __FUNCTION__); \
+        uint32_t log_suppressed = 0;                                                                           \
+        if (!log_rate_limiter.Allow(log_suppressed)) {                                                         \
+          break;                                                                                               \
+        }                                                                                                      \
+        auto log_text = std::format("[{}][{}][{}][{}] " msg, __FILE__, __LINE__, tag,                          \
+                                    __FUNCTION__ __VA_OPT__(, ) __VA_ARGS__);                                  \
+        if (log_suppressed > 0) {                                                                              \
+          log_text += std::format(" (suppressed {} message(s) from this call site)", log_suppressed);          \
+        }                                                                                                      \
+        spdlog::default_logger_raw()->log(level, log_text);                                                    \
+      }                                                                                                        \
+    }                                                                                                          \
+  } while (0)
+
+#define LOGT(tag, msg, ...) LOG_IMPL(spdlog::level::trace, tag, msg __VA_OPT__(, ) __VA_ARGS__)
+#define LOGD(tag, msg, ...) LOG_IMPL(spdlog::level::debug, tag, msg __VA_OPT__(, ) __VA_ARGS__)
+#define LOGI(tag, msg, ...) LOG_IMPL(spdlog::level::info, tag, msg __VA_OPT__(, ) __VA_ARGS__)
+#define LOGW(tag, msg, ...) LOG_IMPL(spdlog::level::warn, tag, msg __VA_OPT__(, ) __VA_ARGS__)
+#define LOGE(tag, msg, ...) LOG_IMPL(spdlog::level::err, tag, msg __VA_OPT__(, ) __VA_ARGS__)
+#define LOGC(tag, msg, ...) LOG_IMPL(spdlog::level::critical, tag, msg __VA_OPT__(, ) __VA_ARGS__)
 
 namespace engine::utils {
+/**
+ * @brief 函数进出日志。只保存指针，级别未开启时构造和析构都只是一次级别判断。
+ */
 class Tracer {
  public:
-  explicit Tracer(const std::string& file_name, int line, const std::string& func_name, const std::string& tag)
-      : log_prefix_(std::format("[{}][{}][{}][{}]", file_name, line, tag, func_name)) {
-    spdlog::info("{} Enter", log_prefix_);
+  explicit Tracer(const char* file_name, int line, const char* func_name, const char* tag)
+      : file_name_(file_name), line_(line), func_name_(func_name), tag_(tag) {
+    Log("Enter");
   }
   ~Tracer() {
-    spdlog::info("{} Exit", log_prefix_);
+    Log("Exit");
   }
   Tracer(const Tracer&) = delete;
   Tracer& operator=(const Tracer&) = delete;
@@ -32,8 +180,22 @@ class Tracer {
   Tracer& operator=(Tracer&&) = delete;
 
  private:
-  std::string log_prefix_;
+  void Log(const char* event) const {
+    if (spdlog::default_logger_raw()->should_log(spdlog::level::info)) {
+      spdlog::default_logger_raw()->log(
+          spdlog::level::info, std::format("[{}][{}][{}][{}] {}", file_name_, line_, tag_, func_name_, event));
+    }
+  }
+
+  const char* file_name_;
+  int line_;
+  const char* func_name_;
+  const char* tag_;
 };
 }  // namespace engine::utils
 
+#if SUNNYLAND_LOG_LEVEL <= SUNNYLAND_LOG_LEVEL_INFO
 #define TRACEI(tag) engine::utils::Tracer tracer(__FILE__, __LINE__, __func__, tag)
+#else
+#define TRACEI(tag) ((void)0)
+#endif
@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 
 namespace engine::object {
 class GameObject;
@@ -9,9 +10,23 @@ class Context;
 }  // namespace engine::core
 
 namespace engine::component {
+class ComponentStorageBase;
+template <typename T>
+class ComponentStorage;
 
+/**
+ * @brief 组件基类。组件按类型存放在 ComponentStorage 中，由所属场景按类型批量驱动：
+ * - 更新顺序是“先按组件类型，再按同类型内的存储顺序”，类型之间按该类型第一次创建的先后排列，
+ *   不再是逐个对象依次更新其全部组件。依赖同一对象上其他组件本帧结果的逻辑不要假设对象内的更新顺序；
+ * - 同类型内的顺序会随交换删除改变，不能依赖；
+ * - 只有所属对象在当前正在更新的场景中、且未标记移除时才会调用 Update/HandleInput，
+ *   暂停（不在栈顶）的场景和尚未加入场景的对象上的组件都不会被驱动。
+ */
 class Component {
   friend class engine::object::GameObject;
+  friend class ComponentStorageBase;
+  template <typename T>
+  friend class ComponentStorage;
 
  public:
   Component() = default;
@@ -34,6 +49,9 @@ class Component {
   }
   virtual void HandleInput(engine::core::Context& context) {
   }
+  // 派生类声明 static constexpr bool kParallelUpdate = true 后，同类型组件的 Update 会分批在任务系统上并行执行。
+  // 这类组件的 Update 只能读写自身和所属对象的数据，不能增删组件/对象，也不能调用渲染、音频等主线程接口；
+  // 也不能移动变换，位置变化会同步更新场景的空间索引。
   virtual void Update(double delta_time_s, engine::core::Context& context) = 0;
 
   virtual void Render(engine::core::Context& context) {
@@ -43,6 +61,11 @@ class Component {
 
  protected:
   engine::object::GameObject* owner_ = nullptr;
+
+ private:
+  // 由 ComponentStorage 维护：所属存储、在紧凑数组中的下标
+  ComponentStorageBase* storage_ = nullptr;
+  uint32_t dense_index_ = 0;
 };
 
 }  // namespace engine::component
\ No newline at end of file
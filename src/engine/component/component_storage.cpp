@@ -0,0 +1,93 @@
+#include "component_storage.h"
+#include "core/context.h"
+#include "core/job_system.h"
+#include "object/game_object.h"
+
+namespace engine::component {
+namespace {
+// 并行更新时每个任务至少处理的组件数，太小时调度开销会盖过收益
+constexpr size_t kParallelBatchSize = 64;
+
+bool ShouldProcess(const Component* component, const engine::scene::Scene* scene) {
+  const auto owner = component->GetOwner();
+  return owner != nullptr && owner->GetScene() == scene && !owner->IsNeedRemove();
+}
+}  // namespace
+
+void ComponentStorageBase::UpdateAll(double delta_time_s, engine::core::Context& context,
+                                     const engine::scene::Scene* scene) {
+  if (is_parallel_update_) {
+    // 并行组件承诺不增删组件，dense_ 在整个过程中保持不变
+    const auto update_batch = [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        Component* component = dense_[i];
+        if (ShouldProcess(component, scene)) {
+          component->Update(delta_time_s, context);
+        }
+      }
+    };
+    context.GetJobSystem().ParallelFor(dense_.size(), kParallelBatchSize, update_batch);
+    return;
+  }
+  // 按下标遍历：组件在 Update 中添加同类型组件时 dense_ 可能扩容
+  for (size_t i = 0; i < dense_.size(); ++i) {
+    Component* component = dense_[i];
+    if (ShouldProcess(component, scene)) {
+      component->Update(delta_time_s, context);
+    }
+  }
+}
+
+void ComponentStorageBase::HandleInputAll(engine::core::Context& context, const engine::scene::Scene* scene) {
+  for (size_t i = 0; i < dense_.size(); ++i) {
+    Component* component = dense_[i];
+    if (ShouldProcess(component, scene)) {
+      component->HandleInput(context);
+    }
+  }
+}
+
+void ComponentStorageBase::AddDense(Component* component) {
+  component->dense_index_ = static_cast<uint32_t>(dense_.size());
+  dense_.push_back(component);
+}
+
+void ComponentStorageBase::RemoveDense(Component* component) {
+  const uint32_t index = component->dense_index_;
+  Component* last = dense_.back();
+  dense_[index] = last;
+  last->dense_index_ = index;
+  dense_.pop_back();
+}
+
+void ComponentRegistry::Register(ComponentStorageBase* storage) {
+  Storages().push_back(storage);
+}
+
+void ComponentRegistry::UpdateAll(double delta_time_s, engine::core::Context& context,
+                                  const engine::scene::Scene* scene) {
+  auto& storages = Storages();
+  for (size_t i = 0; i < storages.size(); ++i) {
+    storages[i]->UpdateAll(delta_time_s, context, scene);
+  }
+}
+
+void ComponentRegistry::HandleInputAll(engine::core::Context& context, const engine::scene::Scene* scene) {
+  auto& storages = Storages();
+  for (size_t i = 0; i < storages.size(); ++i) {
+    storages[i]->HandleInputAll(context, scene);
+  }
+}
+
+void ComponentRegistry::ReleaseUnusedMemory() {
+  for (auto* storage : Storages()) {
+    storage->ReleaseUnusedMemory();
+  }
+}
+
+std::vector<ComponentStorageBase*>& ComponentRegistry::Storages() {
+  static std::vector<ComponentStorageBase*> storages;
+  return storages;
+}
+
+}  // namespace engine::component
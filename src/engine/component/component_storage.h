@@ -0,0 +1,140 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+#include <vector>
+#include "component.h"
+#include "utils/fixed_block_pool.h"
+
+namespace engine::core {
+class Context;
+}  // namespace engine::core
+
+namespace engine::scene {
+class Scene;
+}  // namespace engine::scene
+
+namespace engine::component {
+
+/**
+ * @brief 组件存储的类型擦除基类。
+ * dense_ 中紧凑地保存该类型所有存活组件的指针，批量更新时线性遍历，不再逐个对象查表。
+ */
+class ComponentStorageBase {
+ public:
+  ComponentStorageBase() = default;
+  virtual ~ComponentStorageBase() = default;
+
+  // 禁止拷贝和移动
+  ComponentStorageBase(const ComponentStorageBase&) = delete;
+  ComponentStorageBase& operator=(const ComponentStorageBase&) = delete;
+  ComponentStorageBase(ComponentStorageBase&&) = delete;
+  ComponentStorageBase& operator=(ComponentStorageBase&&) = delete;
+
+  // 析构组件并归还内存块，调用方负责先调用 Clean
+  virtual void Destroy(Component* component) = 0;
+  // 没有存活组件时把池内存整体还给系统
+  virtual void ReleaseUnusedMemory() = 0;
+
+  // 只驱动属于 scene 且未标记移除的对象上的组件，其他场景（包括暂停的场景）的组件原样跳过
+  void UpdateAll(double delta_time_s, engine::core::Context& context, const engine::scene::Scene* scene);
+  void HandleInputAll(engine::core::Context& context, const engine::scene::Scene* scene);
+
+  [[nodiscard]] size_t Size() const {
+    return dense_.size();
+  }
+
+ protected:
+  void AddDense(Component* component);
+  // 交换删除：末尾元素填到被删位置，O(1)
+  void RemoveDense(Component* component);
+
+  std::vector<Component*> dense_;
+  bool is_parallel_update_ = false;  // 组件类型声明了 kParallelUpdate
+};
+
+/**
+ * @brief 按注册顺序（即每种组件第一次被创建的顺序）保存所有组件存储，供场景按类型批量驱动组件。
+ * 每次调用只处理传入场景的组件，顺序约定见 Component 的说明。
+ */
+class ComponentRegistry final {
+ public:
+  static void Register(ComponentStorageBase* storage);
+  static void UpdateAll(double delta_time_s, engine::core::Context& context, const engine::scene::Scene* scene);
+  static void HandleInputAll(engine::core::Context& context, const engine::scene::Scene* scene);
+  // 场景清理后调用，释放已经空掉的组件池
+  static void ReleaseUnusedMemory();
+
+ private:
+  static std::vector<ComponentStorageBase*>& Storages();
+};
+
+/**
+ * @brief 单一组件类型的存储。
+ * 组件从该类型专属的 FixedBlockPool 分配，同类型组件在内存中相邻；内存块一旦分配就不移动，所以组件地址稳定，
+ * GameObject 和其他组件可以放心持有裸指针。销毁的组件把内存块还给池，稳定运行时增删组件不碰全局堆。
+ */
+template <typename T>
+class ComponentStorage final : public ComponentStorageBase {
+ public:
+  static ComponentStorage& Instance() {
+    static ComponentStorage storage;
+    return storage;
+  }
+
+  template <typename... Args>
+  T* Create(Args&&... args) {
+    void* block = pool_.Allocate();
+    T* component = nullptr;
+    try {
+      component = ::new (block) T(std::forward<Args>(args)...);
+    } catch (...) {
+      pool_.Deallocate(block);
+      throw;
+    }
+    component->storage_ = this;
+    AddDense(component);
+    return component;
+  }
+
+  void Destroy(Component* component) override {
+    auto* typed = static_cast<T*>(component);
+    RemoveDense(typed);
+    typed->~T();
+    pool_.Deallocate(typed);
+  }
+
+  void ReleaseUnusedMemory() override {
+    if (dense_.empty()) {
+      pool_.ReleaseIfUnused();
+      dense_.shrink_to_fit();
+    }
+  }
+
+  // 线性遍历所有存活的 T，回调中不要增删同类型组件
+  template <typename Fn>
+  void ForEach(Fn&& fn) {
+    for (Component* component : dense_) {
+      fn(*static_cast<T*>(component));
+    }
+  }
+
+ private:
+  static constexpr size_t kChunkCapacity = 64;
+
+  ComponentStorage() : pool_(sizeof(T), alignof(T), kChunkCapacity) {
+    is_parallel_update_ = requires { requires T::kParallelUpdate; };
+    ComponentRegistry::Register(this);
+  }
+  ~ComponentStorage() override {
+    // 正常情况下组件随 GameObject 一起销毁，这里只兜底程序退出时泄漏的组件
+    while (!dense_.empty()) {
+      Destroy(dense_.back());
+    }
+  }
+
+  engine::utils::FixedBlockPool pool_;
+};
+
+}  // namespace engine::component
@@ -0,0 +1,70 @@
+#pragma once
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+
+namespace engine::component {
+
+using ComponentTypeId = uint32_t;
+// 每个 GameObject 的组件表容量，组件类型超过这个数需要调大
+inline constexpr size_t kMaxComponentTypes = 32;
+static_assert(kMaxComponentTypes <= std::numeric_limits<ComponentTypeId>::max(), "组件类型数超出 id 的取值范围");
+
+namespace detail {
+// 某种组件第一次取 id 可能发生在并行更新的工作线程或流水线的模拟线程上，计数器必须是原子的
+inline ComponentTypeId NextComponentTypeId() {
+  static std::atomic<ComponentTypeId> next_id{0};
+  const ComponentTypeId id = next_id.fetch_add(1, std::memory_order_relaxed);
+  // 超出的 id 会被 GameObject 拒绝（AddComponent 报错），调试构建下尽早暴露
+  assert(id < kMaxComponentTypes && "too many component types, increase kMaxComponentTypes");
+  return id;
+}
+
+template <typename T>
+constexpr std::string_view RawTypeName() {
+#if defined(_MSC_VER) && !defined(__clang__)
+  return __FUNCSIG__;
+#else
+  return __PRETTY_FUNCTION__;
+#endif
+}
+}  // namespace detail
+
+/**
+ * @brief 组件类型 id：每种组件第一次使用时从原子计数器领取一个从 0 开始的连续编号，可在任意线程上首次调用。
+ * 编号用作 GameObject 组件表的下标，查找是一次数组访问，不依赖 typeid/RTTI。
+ * 编号只在本次运行内稳定，不要持久化。
+ */
+template <typename T>
+ComponentTypeId GetComponentTypeId() {
+  static const ComponentTypeId id = detail::NextComponentTypeId();
+  return id;
+}
+
+// 编译期取得的类型名，仅用于日志，格式随编译器不同
+template <typename T>
+constexpr std::string_view GetComponentTypeName() {
+  constexpr std::string_view raw = detail::RawTypeName<T>();
+#if defined(_MSC_VER) && !defined(__clang__)
+  constexpr std::string_view prefix = "RawTypeName<";
+  constexpr std::string_view suffix = ">(void)";
+#else
+  constexpr std::string_view prefix = "T = ";
+  constexpr std::string_view suffix = "]";
+#endif
+  constexpr size_t begin = raw.find(prefix);
+  if constexpr (begin == std::string_view::npos) {
+    return raw;
+  } else {
+    constexpr size_t start = begin + prefix.size();
+    // GCC 会在类型后追加 "; std::string_view = ..."，截到第一个分号
+    constexpr size_t semicolon = raw.find(';', start);
+    constexpr size_t end = semicolon != std::string_view::npos ? semicolon : raw.rfind(suffix);
+    return raw.substr(start, end - start);
+  }
+}
+
+}  // namespace engine::component
@@ -0,0 +1,45 @@
+#include "parallax_component.h"
+#include "core/context.h"
+#include "core/time.h"
+#include "logger.hpp"
+#include "object/game_object.h"
+#include "render/camera.h"
+#include "render/renderer.h"
+#include "resource/resource_manager.h"
+#include "transform_component.h"
+
+namespace engine::component {
+namespace {
+DECLARE_TAG(ParallaxComponent);
+}  // namespace
+
+ParallaxComponent::ParallaxComponent(const std::string& texture_id,
+                                     engine::resource::ResourceManager& resource_manager,
+                                     const glm::vec2& scroll_factor, const glm::bvec2& repeat)
+    : resource_manager_(&resource_manager), sprite_(texture_id), scroll_factor_(scroll_factor), repeat_(repeat) {
+  LOGT(TAG, "Create ParallaxComponent, texture_id: {}", texture_id);
+}
+
+void ParallaxComponent::Init() {
+  if (!owner_) {
+    LOGC(TAG, "Failed to init ParallaxComponent, owner is null!");
+    return;
+  }
+  transform_ = owner_->GetComponent<TransformComponent>();
+  if (!transform_) {
+    LOGW(TAG, "GameObject need a TransformComponent to use ParallaxComponent!");
+  }
+  // 在场景搭建阶段解析句柄；Render 可能在工作线程上录制，不能在那里加载纹理
+  sprite_.SetTextureHandle(resource_manager_->LoadTexture(sprite_.GetTextureId()));
+}
+
+void ParallaxComponent::Render(engine::core::Context& context) {
+  if (is_hidden_ || !transform_) {
+    return;
+  }
+  const auto alpha = static_cast<float>(context.GetTime().GetInterpolationAlpha());
+  context.GetRenderer().DrawParallax(context.GetCamera(), sprite_, transform_->GetInterpolatedPosition(alpha),
+                                     scroll_factor_, repeat_, transform_->GetInterpolatedScale(alpha));
+}
+
+}  // namespace engine::component
@@ -0,0 +1,80 @@
+#pragma once
+#include <glm/glm.hpp>
+#include <string>
+#include "component.h"
+#include "render/sprite.h"
+
+namespace engine::core {
+class Context;
+}  // namespace engine::core
+
+namespace engine::resource {
+class ResourceManager;
+}  // namespace engine::resource
+
+namespace engine::component {
+class TransformComponent;
+
+/**
+ * @brief 视差背景组件：按滚动系数跟随相机移动，并可在 x/y 方向平铺。
+ */
+class ParallaxComponent final : public engine::component::Component {
+  friend class engine::object::GameObject;
+
+ public:
+  explicit ParallaxComponent(const std::string& texture_id, engine::resource::ResourceManager& resource_manager,
+                             const glm::vec2& scroll_factor, const glm::bvec2& repeat = {true, true});
+  ~ParallaxComponent() override = default;
+
+  // 禁止拷贝和移动
+  ParallaxComponent(const ParallaxComponent&) = delete;
+  ParallaxComponent& operator=(const ParallaxComponent&) = delete;
+  ParallaxComponent(ParallaxComponent&&) = delete;
+  ParallaxComponent& operator=(ParallaxComponent&&) = delete;
+
+  // Getters
+  [[nodiscard]] const engine::render::Sprite& GetSprite() const {
+    return sprite_;
+  }
+  [[nodiscard]] const glm::vec2& GetScrollFactor() const {
+    return scroll_factor_;
+  }
+  [[nodiscard]] const glm::bvec2& GetRepeat() const {
+    return repeat_;
+  }
+  [[nodiscard]] bool IsHidden() const {
+    return is_hidden_;
+  }
+
+  // Setters
+  void SetSprite(const engine::render::Sprite& sprite) {
+    sprite_ = sprite;
+  }
+  void SetScrollFactor(const glm::vec2& scroll_factor) {
+    scroll_factor_ = scroll_factor;
+  }
+  void SetRepeat(const glm::bvec2& repeat) {
+    repeat_ = repeat;
+  }
+  void SetHidden(bool hidden) {
+    is_hidden_ = hidden;
+  }
+
+ private:
+  // Component 虚函数覆盖
+  void Init() override;
+  void Update(double delta_time_s, engine::core::Context& context) override {
+  }
+  void Render(engine::core::Context& context) override;
+
+ private:
+  engine::resource::ResourceManager* resource_manager_ = nullptr;
+  TransformComponent* transform_ = nullptr;
+
+  engine::render::Sprite sprite_;
+  glm::vec2 scroll_factor_;
+  glm::bvec2 repeat_;
+  bool is_hidden_ = false;
+};
+
+}  // namespace engine::component
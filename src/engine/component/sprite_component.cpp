@@ -1,5 +1,6 @@
 #include "sprite_component.h"
 #include "core/context.h"
+#include "core/time.h"
 #include "logger.hpp"
 #include "object/game_object.h"
 #include "render/camera.h"
@@ -21,6 +22,9 @@ SpriteComponent::SpriteComponent(const std::string& texture_id, engine::resource
   if (!resource_manager_) {
     // 不要在游戏主循环中使用 try...catch / throw，会极大影响性能
     LOGC(TAG, "Failed to create SpriteComponent, texture_id: {}, ResourceManager is null!", texture_id);
+  } else {
+    sprite_.SetTextureHandle(resource_manager_->LoadTexture(texture_id));
+    is_texture_pending_ = !sprite_.GetTextureHandle().IsValid();
   }
   // offset_ 和 sprite_size_ 将在 init 中计算
   LOGT(TAG, "Create SpriteComponent, texture_id: {}", texture_id);
@@ -40,6 +44,13 @@ void SpriteComponent::Init() {
   // 获取大小及偏移
   UpdateSpriteSize();
   UpdateOffset();
+  owner_->SetCullable(true);
+}
+
+void SpriteComponent::Clean() {
+  if (owner_ && transform_) {
+    owner_->SetCullable(false);
+  }
 }
 
 void SpriteComponent::SetAlignment(engine::utils::Alignment anchor) {
@@ -51,6 +62,7 @@ void SpriteComponent::UpdateOffset() {
   // 如果尺寸无效，偏移为0
   if (sprite_size_.x <= 0 || sprite_size_.y <= 0) {
     offset_ = {0.0f, 0.0f};
+    UpdateBounds();
     return;
   }
   auto scale = transform_->GetScale();
@@ -87,6 +99,37 @@ void SpriteComponent::UpdateOffset() {
   default:
     break;
   }
+  UpdateBounds();
+}
+
+void SpriteComponent::UpdateBounds() {
+  is_world_rect_dirty_ = true;
+  if (!transform_) {
+    return;
+  }
+  // 与 Renderer::DrawSprite 的目标矩形一致：左上角 position + offset，大小为精灵尺寸乘缩放（缩放可为负）
+  const glm::vec2 size = sprite_size_ * transform_->GetScale();
+  transform_->SetLocalBounds({glm::min(offset_, offset_ + size), glm::abs(size)});
+}
+
+void SpriteComponent::Update(double delta_time_s, engine::core::Context& context) {
+  if (is_texture_pending_) {
+    ResolvePendingTexture();
+  }
+}
+
+void SpriteComponent::ResolvePendingTexture() {
+  // 只查找不加载，可以在模拟线程上调用；加载失败的纹理会一直查不到，精灵保持不可见
+  const auto handle = resource_manager_->FindTexture(sprite_.GetTextureId());
+  if (!handle.IsValid()) {
+    return;
+  }
+  sprite_.SetTextureHandle(handle);
+  is_texture_pending_ = false;
+  UpdateSpriteSize();
+  if (transform_) {
+    UpdateOffset();
+  }
 }
 
 void SpriteComponent::Render(engine::core::Context& context) {
@@ -94,18 +137,33 @@ void SpriteComponent::Render(engine::core::Context& context) {
     return;
   }
 
-  // 获取变换信息（考虑偏移量）
-  const glm::vec2& pos = transform_->GetPosition() + offset_;
-  const glm::vec2& scale = transform_->GetScale();
-  float rotation_degrees = transform_->GetRotation();
+  UpdateWorldRect(static_cast<float>(context.GetTime().GetInterpolationAlpha()));
+  context.GetRenderer().DrawSprite(context.GetCamera(), sprite_, world_rect_, world_rotation_, layer_, depth_);
+}
 
-  // 执行绘制
-  context.GetRenderer().DrawSprite(context.GetCamera(), sprite_, pos, scale, rotation_degrees);
+void SpriteComponent::UpdateWorldRect(float alpha) {
+  // 静止的对象（上一步状态等于当前状态）插值结果与 alpha 无关
+  const bool is_alpha_changed = transform_->IsInterpolating() && alpha != world_rect_alpha_;
+  if (!is_world_rect_dirty_ && world_rect_version_ == transform_->GetVersion() && !is_alpha_changed) {
+    return;
+  }
+  // 获取变换信息（考虑偏移量），固定步长模式下在上一步和当前步之间插值
+  const glm::vec2 pos = transform_->GetInterpolatedPosition(alpha) + offset_;
+  const glm::vec2 size = sprite_size_ * transform_->GetInterpolatedScale(alpha);
+  world_rect_ = {pos.x, pos.y, size.x, size.y};
+  world_rotation_ = transform_->GetInterpolatedRotation(alpha);
+  world_rect_version_ = transform_->GetVersion();
+  world_rect_alpha_ = alpha;
+  is_world_rect_dirty_ = false;
 }
 
 void SpriteComponent::SetSpriteById(const std::string& texture_id, const std::optional<SDL_FRect>& source_rect_opt) {
   sprite_.SetTextureId(texture_id);
   sprite_.SetSourceRect(source_rect_opt);
+  if (resource_manager_) {
+    sprite_.SetTextureHandle(resource_manager_->LoadTexture(texture_id));
+    is_texture_pending_ = !sprite_.GetTextureHandle().IsValid();
+  }
 
   UpdateSpriteSize();
   UpdateOffset();
@@ -127,7 +185,7 @@ void SpriteComponent::UpdateSpriteSize() {
     const auto& src_rect = sprite_.GetSourceRect().value();
     sprite_size_ = {src_rect.w, src_rect.h};
   } else {
-    sprite_size_ = resource_manager_->GetTextureSize(sprite_.GetTextureId());
+    sprite_size_ = resource_manager_->GetTextureSize(sprite_.GetTextureHandle());
   }
 }
 
@@ -57,6 +57,12 @@ class SpriteComponent final : public engine::component::Component {
   [[nodiscard]] engine::utils::Alignment GetAlignment() const {
     return alignment_;
   }
+  [[nodiscard]] int32_t GetLayer() const {
+    return layer_;
+  }
+  [[nodiscard]] float GetDepth() const {
+    return depth_;
+  }
 
   // Setters
   void SetSpriteById(const std::string& texture_id, const std::optional<SDL_FRect>& source_rect_opt = std::nullopt);
@@ -66,16 +72,29 @@ class SpriteComponent final : public engine::component::Component {
   void SetHidden(bool hidden) {
     is_hidden_ = hidden;
   }
+  // 同一场景内 layer 大的画在上层；depth 只在 layer 相同且共用纹理（图集页）的精灵之间排序，大的在上
+  void SetLayer(int32_t layer) {
+    layer_ = layer;
+  }
+  void SetDepth(float depth) {
+    depth_ = depth;
+  }
   void SetSourceRect(const std::optional<SDL_FRect>& source_rect_opt);
   void SetAlignment(engine::utils::Alignment anchor);
 
  private:
   void UpdateSpriteSize();
+  // 非主线程创建时纹理只登记了加载请求，加载完成后在这里补上句柄、尺寸和偏移
+  void ResolvePendingTexture();
+  // 把精灵绘制区域（相对变换位置）登记为变换组件的包围盒，场景据此做视口剔除
+  void UpdateBounds();
+  // 变换、尺寸和对齐都没变时沿用上次的世界矩形
+  void UpdateWorldRect(float alpha);
 
   // Component 虚函数覆盖
   void Init() override;
-  void Update(double delta_time_s, engine::core::Context& context) override {
-  }
+  void Clean() override;
+  void Update(double delta_time_s, engine::core::Context& context) override;
   void Render(engine::core::Context& context) override;
 
  private:
@@ -86,7 +105,17 @@ class SpriteComponent final : public engine::component::Component {
   engine::utils::Alignment alignment_ = engine::utils::Alignment::NONE;
   glm::vec2 sprite_size_ = {0.0f, 0.0f};
   glm::vec2 offset_ = {0.0f, 0.0f};
+  int32_t layer_ = 0;
+  float depth_ = 0.0f;
   bool is_hidden_ = false;
+  bool is_texture_pending_ = false;  // 纹理尚未加载（等待主线程），每次 Update 重新查找
+
+  // 世界矩形缓存：对应的变换版本和插值系数，is_world_rect_dirty_ 在尺寸或偏移变化时置位
+  SDL_FRect world_rect_ = {0.0f, 0.0f, 0.0f, 0.0f};
+  float world_rotation_ = 0.0f;
+  uint32_t world_rect_version_ = 0;
+  float world_rect_alpha_ = 0.0f;
+  bool is_world_rect_dirty_ = true;
 };
 
 }  // namespace engine::component
\ No newline at end of file
@@ -0,0 +1,230 @@
+#include "tilelayer_component.h"
+#include "core/context.h"
+#include "logger.hpp"
+#include "render/camera.h"
+#include "render/renderer.h"
+#include "resource/resource_manager.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace engine::component {
+namespace {
+DECLARE_TAG(TileLayerComponent);
+constexpr SDL_FColor kWhite = {1.0f, 1.0f, 1.0f, 1.0f};
+}  // namespace
+
+TileLayerComponent::TileLayerComponent(const glm::ivec2& tile_size, const glm::ivec2& map_size,
+                                       std::vector<TileInfo>&& tile_palette, std::vector<uint32_t>&& tile_indices,
+                                       engine::resource::ResourceManager& resource_manager)
+    : resource_manager_(&resource_manager), tile_size_(tile_size), map_size_(map_size),
+      tile_palette_(std::move(tile_palette)), tile_indices_(std::move(tile_indices)) {
+  if (tile_palette_.empty()) {
+    tile_palette_.emplace_back();
+  }
+  if (tile_indices_.size() != static_cast<size_t>(map_size_.x) * static_cast<size_t>(map_size_.y)) {
+    LOGE(TAG, "Tile count {} does not match map size {}x{}, tiles will be cleared!", tile_indices_.size(),
+         map_size_.x, map_size_.y);
+    tile_indices_.clear();
+    map_size_ = {0, 0};
+  }
+  for (auto& index : tile_indices_) {
+    if (index >= tile_palette_.size()) {
+      LOGW(TAG, "Tile palette index {} out of range ({}), treated as empty", index, tile_palette_.size());
+      index = 0;
+    }
+  }
+  LOGT(TAG, "Create TileLayerComponent, map size: {}x{}, tile size: {}x{}", map_size_.x, map_size_.y, tile_size_.x,
+       tile_size_.y);
+}
+
+void TileLayerComponent::Init() {
+  // 在场景搭建阶段解析纹理句柄；Render 可能在工作线程上录制，只能查找不能加载
+  for (auto& tile : tile_palette_) {
+    if (tile.type != TileType::EMPTY) {
+      tile.sprite.SetTextureHandle(resource_manager_->LoadTexture(tile.sprite.GetTextureId()));
+    }
+  }
+}
+
+const TileInfo* TileLayerComponent::GetTileInfoAt(const glm::ivec2& pos) const {
+  if (pos.x < 0 || pos.x >= map_size_.x || pos.y < 0 || pos.y >= map_size_.y) {
+    return nullptr;
+  }
+  return &tile_palette_[tile_indices_[static_cast<size_t>(pos.y) * map_size_.x + pos.x]];
+}
+
+TileType TileLayerComponent::GetTileTypeAt(const glm::ivec2& pos) const {
+  const auto tile = GetTileInfoAt(pos);
+  return tile ? tile->type : TileType::EMPTY;
+}
+
+TileType TileLayerComponent::GetTileTypeAtWorldPos(const glm::vec2& world_pos) const {
+  if (tile_size_.x <= 0 || tile_size_.y <= 0) {
+    return TileType::EMPTY;
+  }
+  const glm::vec2 local = world_pos - offset_;
+  return GetTileTypeAt({static_cast<int>(std::floor(local.x / static_cast<float>(tile_size_.x))),
+                        static_cast<int>(std::floor(local.y / static_cast<float>(tile_size_.y)))});
+}
+
+void TileLayerComponent::SetOffset(const glm::vec2& offset) {
+  // 分块顶点是图层局部坐标，偏移在绘制时才叠加，无需重建
+  offset_ = offset;
+}
+
+void TileLayerComponent::Render(engine::core::Context& context) {
+  if (is_hidden_ || tile_indices_.empty()) {
+    return;
+  }
+  auto& resource_manager = context.GetResourceManager();
+  if (has_missing_texture_ && !chunks_dirty_) {
+    // 缺失的纹理由主线程加载完成后再重建
+    chunks_dirty_ = std::ranges::any_of(tile_palette_, [&](const TileInfo& tile) {
+      return tile.type != TileType::EMPTY && !tile.sprite.GetTextureHandle().IsValid() &&
+             resource_manager.FindTexture(tile.sprite.GetTextureId()).IsValid();
+    });
+  }
+  if (chunks_dirty_) {
+    BuildChunks(resource_manager);
+  }
+
+  // 计算与视口相交的分块范围（图层局部坐标）。
+  // 超出网格的瓦片向右、向上延伸，所以左边界和下边界要额外放宽。
+  const auto& camera = context.GetCamera();
+  const glm::vec2 view_min = camera.GetPosition() - offset_;
+  const glm::vec2 view_max = view_min + camera.GetViewportSize();
+  const glm::vec2 chunk_size = {static_cast<float>(tile_size_.x * kChunkSize),
+                                static_cast<float>(tile_size_.y * kChunkSize)};
+  const int begin_x = std::max(0, static_cast<int>(std::floor((view_min.x - max_overhang_.x) / chunk_size.x)));
+  const int begin_y = std::max(0, static_cast<int>(std::floor(view_min.y / chunk_size.y)));
+  const int end_x = std::min(chunk_count_.x - 1, static_cast<int>(std::floor(view_max.x / chunk_size.x)));
+  const int end_y =
+      std::min(chunk_count_.y - 1, static_cast<int>(std::floor((view_max.y + max_overhang_.y) / chunk_size.y)));
+
+  // 把可见分块按纹理合并到暂存缓冲，同时完成世界坐标到屏幕坐标的平移
+  for (auto& batch : draw_batches_) {
+    batch.vertices.clear();
+    batch.indices.clear();
+  }
+  const glm::vec2 to_screen = offset_ - camera.GetPosition();
+  for (int cy = begin_y; cy <= end_y; ++cy) {
+    for (int cx = begin_x; cx <= end_x; ++cx) {
+      for (const auto& chunk_batch : chunks_[static_cast<size_t>(cy) * chunk_count_.x + cx].batches) {
+        auto it = std::find_if(draw_batches_.begin(), draw_batches_.end(),
+                               [&](const DrawBatch& b) { return b.texture == chunk_batch.texture; });
+        if (it == draw_batches_.end()) {
+          it = draw_batches_.insert(draw_batches_.end(), DrawBatch{chunk_batch.texture, {}, {}});
+        }
+        const int base = static_cast<int>(it->vertices.size());
+        for (SDL_Vertex vertex : chunk_batch.vertices) {
+          vertex.position.x += to_screen.x;
+          vertex.position.y += to_screen.y;
+          it->vertices.push_back(vertex);
+        }
+        for (const int index : chunk_batch.indices) {
+          it->indices.push_back(base + index);
+        }
+      }
+    }
+  }
+
+  auto& renderer = context.GetRenderer();
+  for (const auto& batch : draw_batches_) {
+    if (batch.vertices.empty()) {
+      continue;
+    }
+    SDL_Texture* texture = resource_manager.GetTexture(batch.texture);
+    if (texture == nullptr) {
+      // 纹理被卸载过，下一帧按路径重新解析并重建分块
+      LOGW(TAG, "Tile texture handle expired, rebuilding chunks");
+      chunks_dirty_ = true;
+      continue;
+    }
+    renderer.DrawGeometry(texture, batch.vertices, batch.indices);
+  }
+}
+
+void TileLayerComponent::Clean() {
+  chunks_.clear();
+  draw_batches_.clear();
+  chunks_dirty_ = true;
+}
+
+void TileLayerComponent::BuildChunks(engine::resource::ResourceManager& resource_manager) {
+  chunk_count_ = {(map_size_.x + kChunkSize - 1) / kChunkSize, (map_size_.y + kChunkSize - 1) / kChunkSize};
+  chunks_.assign(static_cast<size_t>(chunk_count_.x) * chunk_count_.y, Chunk{});
+  max_overhang_ = {0.0f, 0.0f};
+
+  // 纹理被卸载过的瓦片按路径重新查找（只查不加载，未命中时由主线程排队加载，之后再次重建）
+  has_missing_texture_ = false;
+  for (auto& tile : tile_palette_) {
+    if (tile.type == TileType::EMPTY || resource_manager.GetTexture(tile.sprite.GetTextureHandle()) != nullptr) {
+      continue;
+    }
+    tile.sprite.SetTextureHandle(resource_manager.FindTexture(tile.sprite.GetTextureId()));
+    has_missing_texture_ = has_missing_texture_ || !tile.sprite.GetTextureHandle().IsValid();
+  }
+
+  for (int y = 0; y < map_size_.y; ++y) {
+    for (int x = 0; x < map_size_.x; ++x) {
+      const auto& tile = tile_palette_[tile_indices_[static_cast<size_t>(y) * map_size_.x + x]];
+      if (tile.type == TileType::EMPTY || !tile.sprite.GetTextureHandle().IsValid()) {
+        continue;
+      }
+      auto& chunk = chunks_[static_cast<size_t>(y / kChunkSize) * chunk_count_.x + x / kChunkSize];
+      AppendTile(chunk, tile, {x, y}, resource_manager);
+    }
+  }
+  chunks_dirty_ = false;
+  LOGD(TAG, "Built {}x{} tile chunks", chunk_count_.x, chunk_count_.y);
+}
+
+void TileLayerComponent::AppendTile(Chunk& chunk, const TileInfo& tile, const glm::ivec2& tile_pos,
+                                    engine::resource::ResourceManager& resource_manager) {
+  const auto handle = tile.sprite.GetTextureHandle();
+  const auto region = resource_manager.GetTextureRegion(handle);
+  float texture_w = 0.0f;
+  float texture_h = 0.0f;
+  if (region.texture == nullptr || !SDL_GetTextureSize(region.texture, &texture_w, &texture_h)) {
+    LOGE(TAG, "Failed to get texture for tile {}!", tile.sprite.GetTextureId());
+    return;
+  }
+
+  SDL_FRect src = region.rect;
+  if (const auto& src_opt = tile.sprite.GetSourceRect(); src_opt.has_value()) {
+    src = {region.rect.x + src_opt->x, region.rect.y + src_opt->y, src_opt->w, src_opt->h};
+  }
+
+  // 与 Tiled 一致：比网格大的图片瓦片以单元格左下角对齐
+  const glm::vec2 size = (tile.size.x > 0.0f && tile.size.y > 0.0f) ? tile.size : glm::vec2(tile_size_);
+  const float left = static_cast<float>(tile_pos.x * tile_size_.x);
+  const float top = static_cast<float>((tile_pos.y + 1) * tile_size_.y) - size.y;
+  max_overhang_.x = std::max(max_overhang_.x, size.x - static_cast<float>(tile_size_.x));
+  max_overhang_.y = std::max(max_overhang_.y, size.y - static_cast<float>(tile_size_.y));
+
+  float u0 = src.x / texture_w;
+  float u1 = (src.x + src.w) / texture_w;
+  float v0 = src.y / texture_h;
+  float v1 = (src.y + src.h) / texture_h;
+  if (tile.flip_horizontal) {
+    std::swap(u0, u1);
+  }
+  if (tile.flip_vertical) {
+    std::swap(v0, v1);
+  }
+
+  auto it = std::find_if(chunk.batches.begin(), chunk.batches.end(),
+                         [&](const ChunkBatch& b) { return b.texture == handle; });
+  if (it == chunk.batches.end()) {
+    it = chunk.batches.insert(chunk.batches.end(), ChunkBatch{handle, {}, {}});
+  }
+  const int base = static_cast<int>(it->vertices.size());
+  it->vertices.push_back({{left, top}, kWhite, {u0, v0}});
+  it->vertices.push_back({{left + size.x, top}, kWhite, {u1, v0}});
+  it->vertices.push_back({{left + size.x, top + size.y}, kWhite, {u1, v1}});
+  it->vertices.push_back({{left, top + size.y}, kWhite, {u0, v1}});
+  it->indices.insert(it->indices.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+}
+
+}  // namespace engine::component
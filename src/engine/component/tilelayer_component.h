@@ -0,0 +1,139 @@
+#pragma once
+#include <SDL3/SDL_render.h>
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <vector>
+#include "component.h"
+#include "render/sprite.h"
+#include "resource/texture_handle.h"
+
+namespace engine::core {
+class Context;
+}  // namespace engine::core
+
+namespace engine::resource {
+class ResourceManager;
+}  // namespace engine::resource
+
+namespace engine::component {
+
+enum class TileType {
+  EMPTY,   // 空瓦片
+  NORMAL,  // 普通瓦片
+  SOLID,   // 实体瓦片，供之后的碰撞使用
+};
+
+/**
+ * @brief 单个瓦片的信息。sprite 的源矩形相对瓦片所在的原图。
+ * size 为图片瓦片的实际尺寸，可能大于地图网格（Tiled 中按单元格左下角对齐）。
+ */
+struct TileInfo {
+  engine::render::Sprite sprite;
+  TileType type = TileType::EMPTY;
+  glm::vec2 size = {0.0f, 0.0f};
+  bool flip_horizontal = false;
+  bool flip_vertical = false;
+
+  TileInfo(engine::render::Sprite s = engine::render::Sprite(""), TileType t = TileType::EMPTY)
+      : sprite(std::move(s)), type(t) {
+  }
+};
+
+/**
+ * @brief 瓦片图层组件。
+ * 静态瓦片按 kChunkSize x kChunkSize 分块，每块预先生成世界坐标下的顶点/索引缓冲（按纹理分组）。
+ * 渲染时只处理与相机视口相交的分块，并把它们按纹理合并后一次提交，
+ * 所以绘制调用次数只取决于图层用到的纹理数量，而与地图大小无关。
+ * 不同的瓦片（含翻转标志）只在 tile_palette 中存一份，每个格子只存它在调色板中的下标，0 号固定为空瓦片。
+ */
+class TileLayerComponent final : public engine::component::Component {
+  friend class engine::object::GameObject;
+
+ public:
+  static constexpr int kChunkSize = 16;  // 每个分块的边长（瓦片数）
+
+  explicit TileLayerComponent(const glm::ivec2& tile_size, const glm::ivec2& map_size,
+                              std::vector<TileInfo>&& tile_palette, std::vector<uint32_t>&& tile_indices,
+                              engine::resource::ResourceManager& resource_manager);
+  ~TileLayerComponent() override = default;
+
+  // 禁止拷贝和移动
+  TileLayerComponent(const TileLayerComponent&) = delete;
+  TileLayerComponent& operator=(const TileLayerComponent&) = delete;
+  TileLayerComponent(TileLayerComponent&&) = delete;
+  TileLayerComponent& operator=(TileLayerComponent&&) = delete;
+
+  [[nodiscard]] const TileInfo* GetTileInfoAt(const glm::ivec2& pos) const;
+  [[nodiscard]] TileType GetTileTypeAt(const glm::ivec2& pos) const;
+  [[nodiscard]] TileType GetTileTypeAtWorldPos(const glm::vec2& world_pos) const;
+
+  [[nodiscard]] const glm::ivec2& GetTileSize() const {
+    return tile_size_;
+  }
+  [[nodiscard]] const glm::ivec2& GetMapSize() const {
+    return map_size_;
+  }
+  [[nodiscard]] glm::vec2 GetWorldSize() const {
+    return glm::vec2(map_size_ * tile_size_);
+  }
+  [[nodiscard]] const glm::vec2& GetOffset() const {
+    return offset_;
+  }
+  [[nodiscard]] bool IsHidden() const {
+    return is_hidden_;
+  }
+
+  void SetOffset(const glm::vec2& offset);
+  void SetHidden(bool hidden) {
+    is_hidden_ = hidden;
+  }
+  // 瓦片或纹理变化后调用，下一次渲染时重建所有分块
+  void MarkChunksDirty() {
+    chunks_dirty_ = true;
+  }
+
+ private:
+  struct ChunkBatch {
+    engine::resource::TextureHandle texture;
+    std::vector<SDL_Vertex> vertices;  // 世界坐标
+    std::vector<int> indices;
+  };
+  struct Chunk {
+    std::vector<ChunkBatch> batches;
+  };
+  // 一帧内按纹理合并可见分块的暂存缓冲，跨帧复用
+  struct DrawBatch {
+    engine::resource::TextureHandle texture;
+    std::vector<SDL_Vertex> vertices;
+    std::vector<int> indices;
+  };
+
+  void BuildChunks(engine::resource::ResourceManager& resource_manager);
+  void AppendTile(Chunk& chunk, const TileInfo& tile, const glm::ivec2& tile_pos,
+                  engine::resource::ResourceManager& resource_manager);
+
+  // Component 虚函数覆盖
+  void Init() override;
+  void Update(double delta_time_s, engine::core::Context& context) override {
+  }
+  void Render(engine::core::Context& context) override;
+  void Clean() override;
+
+ private:
+  engine::resource::ResourceManager* resource_manager_ = nullptr;
+  glm::ivec2 tile_size_;
+  glm::ivec2 map_size_;
+  std::vector<TileInfo> tile_palette_;  // 0 号为空瓦片
+  std::vector<uint32_t> tile_indices_;  // 每个格子在 tile_palette_ 中的下标，按行存放
+  glm::vec2 offset_ = {0.0f, 0.0f};
+  bool is_hidden_ = false;
+
+  glm::ivec2 chunk_count_ = {0, 0};
+  std::vector<Chunk> chunks_;
+  glm::vec2 max_overhang_ = {0.0f, 0.0f};  // 超出网格的最大瓦片尺寸，扩展可见范围用
+  bool chunks_dirty_ = true;
+  bool has_missing_texture_ = false;  // 上次重建时有瓦片的纹理还未加载
+  std::vector<DrawBatch> draw_batches_;
+};
+
+}  // namespace engine::component
@@ -1,14 +1,62 @@
 #include "transform_component.h"
+#include "component_storage.h"
 #include "object/game_object.h"
+#include "scene/scene.h"
+#include "scene/spatial_grid.h"
 #include "sprite_component.h"
 
+#include <glm/glm.hpp>
+
 namespace engine::component {
 TransformComponent::TransformComponent(glm::vec2 position, glm::vec2 scale, float rotation)
-    : position_(position), scale_(scale), rotation_(rotation) {
+    : position_(position), scale_(scale), rotation_(rotation), previous_position_(position),
+      previous_scale_(scale), previous_rotation_(rotation) {
+}
+
+TransformComponent::~TransformComponent() {
+  // 对象没有经过 Clean 就被销毁（如场景析构）时也要把代理还给空间索引
+  DetachFromSpatialGrid();
+}
+
+void TransformComponent::Init() {
+  if (owner_ && owner_->GetScene()) {
+    AttachToSpatialGrid(owner_->GetScene()->GetSpatialGrid());
+  }
+}
+
+void TransformComponent::Clean() {
+  DetachFromSpatialGrid();
+}
+
+void TransformComponent::SetLocalBounds(const engine::utils::Rect& local_bounds) {
+  local_bounds_ = local_bounds;
+  SyncSpatialProxy();
+}
+
+void TransformComponent::AttachToSpatialGrid(engine::scene::SpatialGrid& spatial_grid) {
+  if (spatial_grid_ == &spatial_grid) {
+    return;
+  }
+  DetachFromSpatialGrid();
+  spatial_grid_ = &spatial_grid;
+  spatial_proxy_ = spatial_grid.Insert(owner_, GetWorldBounds());
+}
+
+void TransformComponent::DetachFromSpatialGrid() {
+  if (spatial_grid_ == nullptr) {
+    return;
+  }
+  spatial_grid_->Remove(spatial_proxy_);
+  spatial_grid_ = nullptr;
+}
+
+void TransformComponent::UpdateSpatialProxy() {
+  spatial_grid_->Update(spatial_proxy_, GetWorldBounds());
 }
 
 void TransformComponent::SetScale(const glm::vec2& scale) {
   scale_ = scale;
+  MarkChanged();
   if (owner_) {
     if (auto sprite_comp = owner_->GetComponent<SpriteComponent>()) {
       sprite_comp->UpdateOffset();
@@ -16,4 +64,34 @@ void TransformComponent::SetScale(const glm::vec2& scale) {
   }
 }
 
+glm::vec2 TransformComponent::GetInterpolatedPosition(float alpha) const {
+  return glm::mix(previous_position_, position_, alpha);
+}
+
+glm::vec2 TransformComponent::GetInterpolatedScale(float alpha) const {
+  return glm::mix(previous_scale_, scale_, alpha);
+}
+
+float TransformComponent::GetInterpolatedRotation(float alpha) const {
+  return glm::mix(previous_rotation_, rotation_, alpha);
+}
+
+void TransformComponent::SavePreviousState() {
+  // 上一步以来没有改变过的变换，上一步状态已经等于当前状态
+  if (!is_interpolating_) {
+    return;
+  }
+  previous_position_ = position_;
+  previous_scale_ = scale_;
+  previous_rotation_ = rotation_;
+  is_interpolating_ = false;
+  ++version_;
+}
+
+void TransformComponent::SavePreviousStates() {
+  // 同类组件在存储中连续排列，一次线性遍历即可
+  ComponentStorage<TransformComponent>::Instance().ForEach(
+      [](TransformComponent& transform) { transform.SavePreviousState(); });
+}
+
 }  // namespace engine::component
\ No newline at end of file
@@ -1,6 +1,11 @@
 #pragma once
 #include <glm/vec2.hpp>
 #include "component.h"
+#include "utils/math.hpp"
+
+namespace engine::scene {
+class SpatialGrid;
+}  // namespace engine::scene
 
 namespace engine::component {
 
@@ -8,12 +13,8 @@ class TransformComponent final : public Component {
   friend class engine::object::GameObject;
 
  public:
-  glm::vec2 position_ = {0.0f, 0.0f};
-  glm::vec2 scale_ = {1.0f, 1.0f};
-  float rotation_ = 0.0f;
-
   explicit TransformComponent(glm::vec2 position = {0.0f, 0.0f}, glm::vec2 scale = {1.0f, 1.0f}, float rotation = 0.0f);
-  ~TransformComponent() override = default;
+  ~TransformComponent() override;
   // 禁止拷贝和移动
   TransformComponent(const TransformComponent&) = delete;
   TransformComponent& operator=(const TransformComponent&) = delete;
@@ -29,18 +30,78 @@ class TransformComponent final : public Component {
   [[nodiscard]] const glm::vec2& GetScale() const {
     return scale_;
   }
+  // 变换（含插值用的上一步状态）每次改变都会递增，依赖变换的缓存比较版本号即可知道是否过期
+  [[nodiscard]] uint32_t GetVersion() const {
+    return version_;
+  }
+  // 上一步状态与当前不同，插值结果随 alpha 变化
+  [[nodiscard]] bool IsInterpolating() const {
+    return is_interpolating_;
+  }
+  // 位置只能通过 SetPosition/Translate 修改，它们会同步更新场景的空间索引
   void SetPosition(const glm::vec2& position) {
     position_ = position;
+    MarkChanged();
+    SyncSpatialProxy();
   }
   void SetRotation(float rotation) {
     rotation_ = rotation;
+    MarkChanged();
   }
   void SetScale(const glm::vec2& scale);
   void Translate(const glm::vec2& offset) {
     position_ += offset;
+    MarkChanged();
+    SyncSpatialProxy();
+  }
+
+  // 相对 position 的包围盒，空间索引按它登记对象；默认大小为 0，只按位置点登记
+  void SetLocalBounds(const engine::utils::Rect& local_bounds);
+  [[nodiscard]] const engine::utils::Rect& GetLocalBounds() const {
+    return local_bounds_;
   }
+  [[nodiscard]] engine::utils::Rect GetWorldBounds() const {
+    return {position_ + local_bounds_.position, local_bounds_.size};
+  }
+  // 登记到场景的空间索引。对象加入场景、或在场景中的对象添加变换组件时自动调用，已登记时不重复登记
+  void AttachToSpatialGrid(engine::scene::SpatialGrid& spatial_grid);
+  void DetachFromSpatialGrid();
+
+  // 固定步长模拟下，渲染在上一步和当前步之间按 alpha 插值，alpha 为 1 时就是当前状态
+  [[nodiscard]] glm::vec2 GetInterpolatedPosition(float alpha) const;
+  [[nodiscard]] glm::vec2 GetInterpolatedScale(float alpha) const;
+  [[nodiscard]] float GetInterpolatedRotation(float alpha) const;
+  // 把当前状态记为上一步状态。瞬移后调用可以避免插值出一段“滑行”
+  void SavePreviousState();
+  // 每个固定步开始前调用，为所有变换组件保存上一步状态
+  static void SavePreviousStates();
 
  private:
+  void Init() override;
+  void Clean() override;
+  void SyncSpatialProxy() {
+    if (spatial_grid_ != nullptr) {
+      UpdateSpatialProxy();
+    }
+  }
+  void UpdateSpatialProxy();
+  void MarkChanged() {
+    ++version_;
+    is_interpolating_ = true;
+  }
+
+  glm::vec2 position_ = {0.0f, 0.0f};
+  glm::vec2 scale_ = {1.0f, 1.0f};
+  float rotation_ = 0.0f;
+  glm::vec2 previous_position_;
+  glm::vec2 previous_scale_;
+  float previous_rotation_;
+  engine::utils::Rect local_bounds_{};
+  engine::scene::SpatialGrid* spatial_grid_ = nullptr;
+  uint32_t spatial_proxy_ = 0;
+  uint32_t version_ = 0;
+  bool is_interpolating_ = false;
+
   void Update(double delta_time_s, engine::core::Context& context) override {
   }
 };
@@ -0,0 +1,129 @@
+#include "benchmark_recorder.h"
+#include "logger.hpp"
+#include "render/render_queue.h"
+#include "utils/allocation_counter.h"
+
+#include <SDL3/SDL_timer.h>
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <nlohmann/json.hpp>
+#include <numeric>
+
+namespace engine::core {
+namespace {
+DECLARE_TAG(BenchmarkRecorder)
+
+// 最近秩法：sorted 已升序，percentile 取 (0, 100]
+double Percentile(const std::vector<double>& sorted, double percentile) {
+  const auto rank = static_cast<size_t>(std::ceil(percentile / 100.0 * static_cast<double>(sorted.size())));
+  return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+}
+
+template <typename T>
+double Mean(const std::vector<T>& values) {
+  double sum = 0.0;
+  for (const auto value : values) {
+    sum += static_cast<double>(value);
+  }
+  return values.empty() ? 0.0 : sum / static_cast<double>(values.size());
+}
+}  // namespace
+
+BenchmarkRecorder::BenchmarkRecorder(const LaunchOptions& options)
+    : frame_count_(options.frame_count), scene_path_(options.scene_path), fixed_delta_s_(options.fixed_delta_s),
+      is_headless_(options.is_headless), output_path_(options.output_path) {
+  samples_.reserve(frame_count_);
+  if (!engine::utils::AllocationCounter::IsEnabled()) {
+    LOGW(TAG, "Allocation counter is compiled out, allocation stats will be zero");
+  }
+}
+
+void BenchmarkRecorder::BeginFrame() {
+  frame_begin_allocations_ = engine::utils::AllocationCounter::GetCount();
+  frame_begin_bytes_ = engine::utils::AllocationCounter::GetBytes();
+  frame_begin_counter_ = SDL_GetPerformanceCounter();
+}
+
+void BenchmarkRecorder::EndFrame(const engine::render::RenderStats& render_stats) {
+  const uint64_t elapsed = SDL_GetPerformanceCounter() - frame_begin_counter_;
+  if (IsComplete()) {
+    return;
+  }
+  FrameSample sample;
+  sample.duration_ns = static_cast<uint64_t>(static_cast<double>(elapsed) * 1'000'000'000.0 /
+                                             static_cast<double>(SDL_GetPerformanceFrequency()));
+  sample.allocations = engine::utils::AllocationCounter::GetCount() - frame_begin_allocations_;
+  sample.allocated_bytes = engine::utils::AllocationCounter::GetBytes() - frame_begin_bytes_;
+  sample.draw_calls = render_stats.draw_calls;
+  sample.sprites = render_stats.sprites;
+  sample.vertices = render_stats.vertices;
+  samples_.push_back(sample);
+}
+
+bool BenchmarkRecorder::WriteReport(const std::string& renderer_name) const {
+  if (samples_.empty()) {
+    LOGE(TAG, "No frames were recorded");
+    return false;
+  }
+
+  std::vector<double> frame_ms;
+  std::vector<uint64_t> allocations;
+  std::vector<uint32_t> draw_calls;
+  std::vector<uint32_t> sprites;
+  std::vector<uint32_t> vertices;
+  uint64_t allocated_bytes = 0;
+  for (const auto& sample : samples_) {
+    frame_ms.push_back(static_cast<double>(sample.duration_ns) / 1'000'000.0);
+    allocations.push_back(sample.allocations);
+    draw_calls.push_back(sample.draw_calls);
+    sprites.push_back(sample.sprites);
+    vertices.push_back(sample.vertices);
+    allocated_bytes += sample.allocated_bytes;
+  }
+  std::vector<double> sorted_ms = frame_ms;
+  std::sort(sorted_ms.begin(), sorted_ms.end());
+
+  nlohmann::json report = {
+      {"scene", scene_path_.empty() ? "default" : scene_path_},
+      {"frames", samples_.size()},
+      {"fixed_delta_s", fixed_delta_s_},
+      {"headless", is_headless_},
+      {"renderer", renderer_name},
+      {"frame_time_ms",
+       {{"mean", Mean(frame_ms)},
+        {"min", sorted_ms.front()},
+        {"p50", Percentile(sorted_ms, 50.0)},
+        {"p90", Percentile(sorted_ms, 90.0)},
+        {"p95", Percentile(sorted_ms, 95.0)},
+        {"p99", Percentile(sorted_ms, 99.0)},
+        {"max", sorted_ms.back()}}},
+      {"allocations",
+       {{"counted", engine::utils::AllocationCounter::IsEnabled()},
+        {"total", std::accumulate(allocations.begin(), allocations.end(), uint64_t{0})},
+        {"per_frame_mean", Mean(allocations)},
+        {"per_frame_max", *std::max_element(allocations.begin(), allocations.end())},
+        {"bytes_total", allocated_bytes}}},
+      {"draw_calls",
+       {{"total", std::accumulate(draw_calls.begin(), draw_calls.end(), uint64_t{0})},
+        {"per_frame_mean", Mean(draw_calls)},
+        {"per_frame_max", *std::max_element(draw_calls.begin(), draw_calls.end())}}},
+      {"sprites_per_frame_mean", Mean(sprites)},
+      {"vertices_per_frame_mean", Mean(vertices)}};
+
+  if (output_path_.empty()) {
+    std::cout << report.dump(2) << std::endl;
+    return true;
+  }
+  std::ofstream file(output_path_);
+  if (!file.is_open()) {
+    LOGE(TAG, "Failed to open benchmark report file: {}", output_path_);
+    return false;
+  }
+  file << report.dump(2) << '\n';
+  LOGI(TAG, "Benchmark report written to {}", output_path_);
+  return file.good();
+}
+
+}  // namespace engine::core
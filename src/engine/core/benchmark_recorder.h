@@ -0,0 +1,59 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "launch_options.h"
+
+namespace engine::render {
+struct RenderStats;
+}  // namespace engine::render
+
+namespace engine::core {
+
+/**
+ * @brief 基准测试模式下逐帧采样：帧耗时、堆分配次数/字节数、绘制调用数，结束后汇总成 JSON 报告。
+ * 每帧的采样都预先分配好，采样本身不产生堆分配，不会污染分配计数。
+ */
+class BenchmarkRecorder final {
+ public:
+  explicit BenchmarkRecorder(const LaunchOptions& options);
+
+  // 禁止拷贝和移动
+  BenchmarkRecorder(const BenchmarkRecorder&) = delete;
+  BenchmarkRecorder& operator=(const BenchmarkRecorder&) = delete;
+  BenchmarkRecorder(BenchmarkRecorder&&) = delete;
+  BenchmarkRecorder& operator=(BenchmarkRecorder&&) = delete;
+
+  void BeginFrame();
+  void EndFrame(const engine::render::RenderStats& render_stats);
+
+  [[nodiscard]] bool IsComplete() const {
+    return samples_.size() >= frame_count_;
+  }
+
+  // 写到 --out 指定的文件，没有指定时打印到标准输出
+  bool WriteReport(const std::string& renderer_name) const;
+
+ private:
+  struct FrameSample {
+    uint64_t duration_ns = 0;
+    uint64_t allocations = 0;
+    uint64_t allocated_bytes = 0;
+    uint32_t draw_calls = 0;
+    uint32_t sprites = 0;
+    uint32_t vertices = 0;
+  };
+
+  uint32_t frame_count_;
+  std::string scene_path_;
+  double fixed_delta_s_;
+  bool is_headless_;
+  std::string output_path_;
+
+  std::vector<FrameSample> samples_;
+  uint64_t frame_begin_counter_ = 0;
+  uint64_t frame_begin_allocations_ = 0;
+  uint64_t frame_begin_bytes_ = 0;
+};
+
+}  // namespace engine::core
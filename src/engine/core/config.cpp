@@ -6,6 +6,18 @@
 namespace engine::core {
 namespace {
 DECLARE_TAG(Config)
+constexpr int32_t kVSyncAdaptive = -1;
+
+// 常用取值写回成可读的形式，与读取时接受的写法对应
+nlohmann::ordered_json VSyncToJson(int32_t vsync) {
+  if (vsync == 0 || vsync == 1) {
+    return vsync == 1;
+  }
+  if (vsync == kVSyncAdaptive) {
+    return "adaptive";
+  }
+  return vsync;
+}
 }  // namespace
 
 Config::Config(const std::string& file_name) {
@@ -59,13 +71,28 @@ const int32_t& Config::WindowHeight() const {
 const bool& Config::WindowResizable() const {
   return window_resizable_;
 }
-const bool& Config::VSync() const {
+const int32_t& Config::VSync() const {
   return vsync_;
 }
 
 const int32_t& Config::TargetFps() const {
   return target_fps_;
 }
+const bool& Config::UseDisplayRefreshRate() const {
+  return use_display_refresh_rate_;
+}
+const int32_t& Config::FixedUpdateFps() const {
+  return fixed_update_fps_;
+}
+const int32_t& Config::MaxFixedStepsPerFrame() const {
+  return max_fixed_steps_per_frame_;
+}
+const int32_t& Config::WorkerThreads() const {
+  return worker_threads_;
+}
+const bool& Config::PipelinedRendering() const {
+  return pipelined_rendering_;
+}
 const float& Config::MusicVolume() const {
   return music_volume_;
 }
@@ -96,19 +123,53 @@ void Config::FromJson(const nlohmann::json& json) {
   if (json.contains("graphics")) {
     const auto& graphics_json = json["graphics"];
     if (graphics_json.contains("vsync")) {
-      vsync_ = graphics_json["vsync"];
+      const auto& vsync_json = graphics_json["vsync"];
+      if (vsync_json.is_boolean()) {
+        vsync_ = vsync_json.get<bool>() ? 1 : 0;
+      } else if (vsync_json.is_number_integer()) {
+        vsync_ = vsync_json;
+      } else if (vsync_json == "adaptive") {
+        vsync_ = kVSyncAdaptive;
+      } else {
+        LOGE(TAG, "Invalid vsync value {}, expected true, false, \"adaptive\" or an integer", vsync_json.dump());
+      }
     }
   }
 
   if (json.contains("performance")) {
     const auto& performance_json = json["performance"];
-    if (performance_json.contains("fps")) {
-      target_fps_ = performance_json["fps"];
+    // 配置文件写的是 target_fps（SaveConfig 也写这个键），旧的 fps 键作为兼容
+    const char* fps_key = performance_json.contains("target_fps") ? "target_fps" : "fps";
+    if (performance_json.contains(fps_key)) {
+      target_fps_ = performance_json[fps_key];
       if (target_fps_ <= 0) {
         LOGE(TAG, "TargetFps must be greater than zero, 0 is unlimited");
         target_fps_ = 0;
       }
     }
+    if (performance_json.contains("use_display_refresh_rate")) {
+      use_display_refresh_rate_ = performance_json["use_display_refresh_rate"];
+    }
+    if (performance_json.contains("fixed_update_fps")) {
+      fixed_update_fps_ = performance_json["fixed_update_fps"];
+      if (fixed_update_fps_ < 0) {
+        LOGE(TAG, "FixedUpdateFps must not be negative, 0 disables fixed timestep");
+        fixed_update_fps_ = 0;
+      }
+    }
+    if (performance_json.contains("max_fixed_steps_per_frame")) {
+      max_fixed_steps_per_frame_ = performance_json["max_fixed_steps_per_frame"];
+    }
+    if (performance_json.contains("worker_threads")) {
+      worker_threads_ = performance_json["worker_threads"];
+      if (worker_threads_ < 0) {
+        LOGE(TAG, "WorkerThreads must not be negative, 0 is auto");
+        worker_threads_ = 0;
+      }
+    }
+    if (performance_json.contains("pipelined_rendering")) {
+      pipelined_rendering_ = performance_json["pipelined_rendering"];
+    }
   }
   if (json.contains("audio")) {
     const auto& audio_json = json["audio"];
@@ -139,8 +200,14 @@ nlohmann::json Config::ToJson() const {
                                   {"width", window_width_},
                                   {"height", window_height_},
                                   {"resizable", window_resizable_}}},
-                                {"graphics", {{"vsync", vsync_}}},
-                                {"performance", {{"target_fps", target_fps_}}},
+                                {"graphics", {{"vsync", VSyncToJson(vsync_)}}},
+                                {"performance",
+                                 {{"target_fps", target_fps_},
+                                  {"use_display_refresh_rate", use_display_refresh_rate_},
+                                  {"fixed_update_fps", fixed_update_fps_},
+                                  {"max_fixed_steps_per_frame", max_fixed_steps_per_frame_},
+                                  {"worker_threads", worker_threads_},
+                                  {"pipelined_rendering", pipelined_rendering_}}},
                                 {"audio", {{"music_volume", music_volume_}, {"sound_volume", sound_volume_}}},
                                 {"input_mappings", input_mappings_}};
 }
@@ -22,8 +22,14 @@ class Config final {
   const int32_t& WindowWidth() const;
   const int32_t& WindowHeight() const;
   const bool& WindowResizable() const;
-  const bool& VSync() const;
+  // 与 SDL_SetRenderVSync 的取值一致：0 关闭，1 每次垂直同步呈现一帧，-1 自适应
+  const int32_t& VSync() const;
   const int32_t& TargetFps() const;
+  const bool& UseDisplayRefreshRate() const;
+  const int32_t& FixedUpdateFps() const;
+  const int32_t& MaxFixedStepsPerFrame() const;
+  const int32_t& WorkerThreads() const;
+  const bool& PipelinedRendering() const;
   const float& MusicVolume() const;
   const float& SoundVolume() const;
   const std::unordered_map<std::string, std::vector<std::string>>& InputMappings() const;
@@ -40,9 +46,14 @@ class Config final {
 
   bool is_fullscreen_{false};
   float framerate_limit_{60.0f};
-  bool vsync_{true};
+  int32_t vsync_{1};  // 配置文件里可写 true/false、"adaptive" 或 SDL 的同步间隔数值
 
   int32_t target_fps_{144};
+  bool use_display_refresh_rate_{false};  // 为 true 时帧间隔取显示器刷新率，忽略 target_fps
+  int32_t fixed_update_fps_{0};  // 0 表示不使用固定步长
+  int32_t max_fixed_steps_per_frame_{5};
+  int32_t worker_threads_{0};  // 0 表示按硬件线程数自动决定
+  bool pipelined_rendering_{false};  // 模拟与渲染提交分属两个线程，重叠执行
 
   float music_volume_{0.5f};
   float sound_volume_{0.5f};
@@ -50,6 +61,6 @@ class Config final {
   std::unordered_map<std::string, std::vector<std::string>> input_mappings_{
       {"move_left", {"A", "Left"}}, {"move_right", {"D", "Right"}}, {"move_up", {"W", "Up"}},
       {"move_down", {"S", "Down"}}, {"jump", {"J", "Space"}},       {"attack", {"K", "MouseLeft"}},
-      {"pause", {"P", "Escape"}}};
+      {"pause", {"P", "Escape"}},   {"profiler_dump", {"F9"}}};
 };
 }  // namespace engine::core
@@ -1,15 +1,19 @@
 #include "context.h"
 #include "input/input_manager.h"
+#include "job_system.h"
 #include "logger.hpp"
 #include "render/camera.h"
 #include "render/renderer.h"
 #include "resource/resource_manager.h"
+#include "time.h"
 
 namespace engine::core {
 
 Context::Context(engine::input::InputManager& input_manager, engine::render::Renderer& renderer,
-                 engine::render::Camera& camera, engine::resource::ResourceManager& resource_manager)
-    : input_manager_(input_manager), renderer_(renderer), camera_(camera), resource_manager_(resource_manager) {
+                 engine::render::Camera& camera, engine::resource::ResourceManager& resource_manager, Time& time,
+                 JobSystem& job_system)
+    : input_manager_(input_manager), renderer_(renderer), camera_(camera), resource_manager_(resource_manager),
+      time_(time), job_system_(job_system) {
   TRACEI("Context");
 }
 
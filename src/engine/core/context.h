@@ -14,11 +14,14 @@ class ResourceManager;
 }  // namespace engine::resource
 
 namespace engine::core {
+class Time;
+class JobSystem;
 
 class Context final {
  public:
   explicit Context(engine::input::InputManager& input_manager, engine::render::Renderer& renderer,
-                   engine::render::Camera& camera, engine::resource::ResourceManager& resource_manager);
+                   engine::render::Camera& camera, engine::resource::ResourceManager& resource_manager,
+                   Time& time, JobSystem& job_system);
 
   // 禁止拷贝和移动，Context 对象通常是唯一的或按需创建/传递
   Context(const Context&) = delete;
@@ -38,12 +41,20 @@ class Context final {
   [[nodiscard]] engine::resource::ResourceManager& GetResourceManager() const {
     return resource_manager_;
   }
+  [[nodiscard]] Time& GetTime() const {
+    return time_;
+  }
+  [[nodiscard]] JobSystem& GetJobSystem() const {
+    return job_system_;
+  }
 
  private:
   engine::input::InputManager& input_manager_;
   engine::render::Renderer& renderer_;
   engine::render::Camera& camera_;
   engine::resource::ResourceManager& resource_manager_;
+  Time& time_;
+  JobSystem& job_system_;
 };
 
 }  // namespace engine::core
\ No newline at end of file
@@ -0,0 +1,99 @@
+#include "frame_pacer.h"
+#include "logger.hpp"
+#include "utils/profiler.h"
+
+#include <SDL3/SDL_timer.h>
+#include <algorithm>
+#include <cmath>
+
+namespace engine::core {
+namespace {
+DECLARE_TAG(FramePacer)
+constexpr uint64_t kMinSpinThresholdNs = 200'000;    // 0.2ms
+constexpr uint64_t kMaxSpinThresholdNs = 4'000'000;  // 4ms，常见调度粒度的上限
+constexpr uint64_t kInitialSpinThresholdNs = 1'500'000;
+constexpr uint64_t kReportIntervalNs = 5'000'000'000;  // 每 5 秒输出一次统计
+}  // namespace
+
+FramePacer::FramePacer() : spin_threshold_ns_(kInitialSpinThresholdNs) {
+}
+
+void FramePacer::SetTargetInterval(uint64_t interval_ns) {
+  interval_ns_ = interval_ns;
+  next_deadline_ns_ = 0;
+  ResetStats();
+}
+
+void FramePacer::WaitForNextFrame() {
+  PROFILE_SCOPE("FramePacer::Wait");
+  if (interval_ns_ == 0) {
+    return;
+  }
+  const uint64_t now = SDL_GetTicksNS();
+  if (next_deadline_ns_ == 0) {
+    // 第一帧只建立时间表
+    next_deadline_ns_ = now + interval_ns_;
+    last_report_ns_ = now;
+    return;
+  }
+
+  if (now < next_deadline_ns_) {
+    SleepUntil(next_deadline_ns_);
+  }
+  const uint64_t woke = SDL_GetTicksNS();
+  RecordError(static_cast<int64_t>(woke) - static_cast<int64_t>(next_deadline_ns_));
+
+  // 沿时间表推进，偶尔晚一点会在后续帧里追回；落后超过一整帧则放弃追赶，从现在重新对齐
+  next_deadline_ns_ += interval_ns_;
+  if (woke > next_deadline_ns_) {
+    ++stats_.missed_frames;
+    next_deadline_ns_ = woke + interval_ns_;
+  }
+
+  if (woke - last_report_ns_ >= kReportIntervalNs) {
+    LOGD(TAG, "frames: {}, missed: {}, error mean: {:.1f}us, max: {:.1f}us, stddev: {:.1f}us, spin: {}us",
+         stats_.frame_count, stats_.missed_frames, stats_.mean_error_us, stats_.max_error_us, stats_.stddev_error_us,
+         spin_threshold_ns_ / 1000);
+    last_report_ns_ = woke;
+  }
+}
+
+void FramePacer::ResetStats() {
+  stats_ = {};
+  error_sum_us_ = 0.0;
+  error_square_sum_us_ = 0.0;
+}
+
+void FramePacer::SleepUntil(uint64_t deadline_ns) {
+  // 粗睡眠：留出余量，避免系统调度把我们睡过头
+  const uint64_t now = SDL_GetTicksNS();
+  if (deadline_ns > now + spin_threshold_ns_) {
+    const uint64_t sleep_ns = deadline_ns - now - spin_threshold_ns_;
+    SDL_DelayNS(sleep_ns);
+    const uint64_t slept = SDL_GetTicksNS() - now;
+    const uint64_t overshoot = slept > sleep_ns ? slept - sleep_ns : 0;
+    // 睡过头说明余量不够，立即放大；否则缓慢收缩，减少忙等占用的 CPU
+    if (overshoot + kMinSpinThresholdNs > spin_threshold_ns_) {
+      spin_threshold_ns_ = std::min(kMaxSpinThresholdNs, (overshoot + kMinSpinThresholdNs) * 5 / 4);
+    } else {
+      spin_threshold_ns_ -= (spin_threshold_ns_ - kMinSpinThresholdNs) / 64;
+    }
+  }
+  // 精确等待：忙等到计划时刻
+  while (SDL_GetTicksNS() < deadline_ns) {
+  }
+}
+
+void FramePacer::RecordError(int64_t error_ns) {
+  const double error_us = static_cast<double>(error_ns) / 1000.0;
+  ++stats_.frame_count;
+  error_sum_us_ += error_us;
+  error_square_sum_us_ += error_us * error_us;
+  const auto count = static_cast<double>(stats_.frame_count);
+  stats_.mean_error_us = error_sum_us_ / count;
+  stats_.max_error_us = std::max(stats_.max_error_us, error_us);
+  stats_.stddev_error_us =
+      std::sqrt(std::max(0.0, error_square_sum_us_ / count - stats_.mean_error_us * stats_.mean_error_us));
+}
+
+}  // namespace engine::core
@@ -0,0 +1,65 @@
+#pragma once
+#include <cstdint>
+
+namespace engine::core {
+
+/**
+ * @brief 帧节奏统计，误差指实际开始时刻相对计划时刻的偏差（晚为正）。
+ */
+struct FramePacerStats {
+  uint64_t frame_count = 0;
+  uint64_t missed_frames = 0;  // 晚于计划超过一整帧、被迫重新对齐的次数
+  double mean_error_us = 0.0;
+  double max_error_us = 0.0;
+  double stddev_error_us = 0.0;
+};
+
+/**
+ * @brief 高精度帧节奏控制。
+ * 按绝对时间表推进：每帧的计划开始时刻 = 上一帧计划时刻 + 间隔，单帧的偏差不会累积成漂移。
+ * 等待分两段：先用系统睡眠睡到计划时刻前的一小段余量，再忙等到计划时刻。
+ * 余量会根据实际观测到的睡眠超时自适应调整，在精度和 CPU 占用之间取平衡。
+ */
+class FramePacer final {
+ public:
+  FramePacer();
+
+  // 禁止拷贝和移动
+  FramePacer(const FramePacer&) = delete;
+  FramePacer& operator=(const FramePacer&) = delete;
+  FramePacer(FramePacer&&) = delete;
+  FramePacer& operator=(FramePacer&&) = delete;
+
+  // 0 表示不限帧
+  void SetTargetInterval(uint64_t interval_ns);
+  [[nodiscard]] uint64_t GetTargetInterval() const {
+    return interval_ns_;
+  }
+  [[nodiscard]] bool IsEnabled() const {
+    return interval_ns_ > 0;
+  }
+
+  // 阻塞到下一帧的计划开始时刻
+  void WaitForNextFrame();
+
+  // 自上次 ResetStats（或修改帧间隔）以来的累计数据
+  [[nodiscard]] const FramePacerStats& GetStats() const {
+    return stats_;
+  }
+  void ResetStats();
+
+ private:
+  void SleepUntil(uint64_t deadline_ns);
+  void RecordError(int64_t error_ns);
+
+  uint64_t interval_ns_ = 0;
+  uint64_t next_deadline_ns_ = 0;
+  uint64_t spin_threshold_ns_;  // 计划时刻前改为忙等的余量
+
+  FramePacerStats stats_;
+  double error_sum_us_ = 0.0;
+  double error_square_sum_us_ = 0.0;
+  uint64_t last_report_ns_ = 0;
+};
+
+}  // namespace engine::core
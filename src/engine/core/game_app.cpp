@@ -1,10 +1,12 @@
 #include "game_app.h"
+#include "benchmark_recorder.h"
 #include "component/sprite_component.h"
 #include "component/transform_component.h"
 #include "config.h"
 #include "context.h"
 #include "game/scene/game_scene.h"
 #include "input/input_manager.h"
+#include "job_system.h"
 #include "logger.hpp"
 #include "object/game_object.h"
 #include "render/camera.h"
@@ -13,15 +15,21 @@
 #include "resource/resource_manager.h"
 #include "scene/scene_manager.h"
 #include "time.h"
+#include "utils/profiler.h"
 
 #include <SDL3/SDL.h>
+#include <cmath>
+#include <cstdlib>
 
 namespace engine::core {
 namespace {
 DECLARE_TAG(GameApp)
-
+// 每帧用于把后台解码好的资源上传到 GPU 的时间预算
+constexpr uint64_t kResourceUploadBudgetNs = 2'000'000;
+// 基准测试预热的帧数上限，超过仍未进入场景则认为加载失败
+constexpr uint32_t kMaxBenchmarkWarmupFrames = 10'000;
 }  // namespace
-GameApp::GameApp() {
+GameApp::GameApp(LaunchOptions options) : options_(std::move(options)) {
   TRACEI(TAG);
 }
 GameApp::~GameApp() {
@@ -31,24 +39,96 @@ GameApp::~GameApp() {
     Close();
   }
 }
-void GameApp::Run() {
+int GameApp::Run() {
   TRACEI(TAG);
   if (!Init()) {
     LOGE(TAG, "Failed to initialize!");
-    return;
+    return EXIT_FAILURE;
   }
   LOGI(TAG, "Running...");
-  time_->SetTargetFPS(144);
+  engine::utils::Profiler::SetThreadName("Main");
+  const bool is_pipelined = config_->PipelinedRendering();
   while (is_running_) {
-    time_->Update();
-    double delta_time_s = time_->GetDeltaTimeS();
-
-    input_manager_->Update();
-    HandleEvents();
-    Update(delta_time_s);
-    Render();
+    if (is_benchmark_recording_) {
+      benchmark_recorder_->BeginFrame();
+    }
+    {
+      PROFILE_SCOPE("Frame");
+      time_->Update();
+      resource_manager_->Update(kResourceUploadBudgetNs);
+      input_manager_->Update();
+      HandleEvents();
+      if (is_pipelined) {
+        RunPipelinedFrame();
+      } else {
+        Simulate();
+        Render();
+      }
+    }
+    if (benchmark_recorder_) {
+      UpdateBenchmark();
+    }
+    engine::utils::FlushSuppressedLogs();
+  }
+  engine::utils::FlushSuppressedLogs(true);
+  return exit_code_;
+}
+void GameApp::UpdateBenchmark() {
+  if (is_benchmark_recording_) {
+    benchmark_recorder_->EndFrame(renderer_->GetLastFrameStats());
+    if (benchmark_recorder_->IsComplete()) {
+      const char* renderer_name = SDL_GetRendererName(sdl_renderer_);
+      if (!benchmark_recorder_->WriteReport(renderer_name != nullptr ? renderer_name : "unknown")) {
+        exit_code_ = EXIT_FAILURE;
+      }
+      is_running_ = false;
+    }
+    return;
+  }
+  if (scene_manager_->GetCurrentScene() != nullptr && resource_manager_->IsLoadingIdle()) {
+    LOGI(TAG, "Benchmark warmed up after {} frames, recording {} frames", benchmark_warmup_frames_,
+         options_.frame_count);
+    is_benchmark_recording_ = true;
+    return;
+  }
+  if (++benchmark_warmup_frames_ > kMaxBenchmarkWarmupFrames) {
+    LOGE(TAG, "Benchmark scene was not ready after {} frames", kMaxBenchmarkWarmupFrames);
+    exit_code_ = EXIT_FAILURE;
+    is_running_ = false;
+  }
+}
+void GameApp::Simulate() {
+  PROFILE_SCOPE("GameApp::Simulate");
+  if (time_->IsFixedStepEnabled()) {
+    // 固定步长：按积压时间执行 0~N 次模拟，渲染再用插值补齐步与步之间的位置
+    const int32_t steps = time_->ConsumeFixedSteps();
+    for (int32_t i = 0; i < steps; ++i) {
+      engine::component::TransformComponent::SavePreviousStates();
+      Update(time_->GetFixedDeltaTimeS());
+    }
+  } else {
+    Update(time_->GetDeltaTimeS());
   }
 }
+void GameApp::RunPipelinedFrame() {
+  // 同步点：模拟任务已结束。场景切换在这里执行，上一轮录好的帧交给提交侧
+  scene_manager_->ProcessPendingActions();
+  renderer_->EndFrame();
+
+  // 模拟任务推进并录制第 N+1 帧，主线程同时提交第 N 帧；SDL 渲染调用只发生在主线程
+  JobCounter simulation_done;
+  job_system_->Submit(
+      [](void* data, size_t, size_t) {
+        auto* app = static_cast<GameApp*>(data);
+        app->Simulate();
+        app->scene_manager_->Render();
+      },
+      this, 0, 0, simulation_done);
+  renderer_->ClearScreen();
+  renderer_->SubmitFrame();
+  PROFILE_SCOPE("GameApp::WaitSimulation");
+  job_system_->Wait(simulation_done);
+}
 bool GameApp::Init() {
   TRACEI(TAG);
   if (!InitConfig()) {
@@ -70,6 +150,10 @@ bool GameApp::Init() {
     LOGE(TAG, "Failed to initialize!");
     return false;
   }
+  if (!InitJobSystem()) {
+    LOGE(TAG, "Failed to initialize!");
+    return false;
+  }
   if (!InitResourceManager()) {
     LOGE(TAG, "Failed to initialize!");
     return false;
@@ -91,7 +175,12 @@ bool GameApp::Init() {
     return false;
   }
 
-  auto scene = std::make_unique<game::scene::GameScene>("GameScene", *context_, *scene_manager_);
+  if (options_.IsBenchmark()) {
+    benchmark_recorder_ = std::make_unique<BenchmarkRecorder>(options_);
+  }
+
+  auto scene =
+      std::make_unique<game::scene::GameScene>("GameScene", *context_, *scene_manager_, options_.scene_path);
   scene_manager_->RequestPushScene(std::move(scene));
 
   is_running_ = true;
@@ -104,6 +193,7 @@ void GameApp::Update(double delta_time_s) {
 }
 
 void GameApp::Render() {
+  PROFILE_SCOPE("GameApp::Render");
   renderer_->ClearScreen();
   scene_manager_->Render();
   renderer_->Present();
@@ -114,6 +204,9 @@ void GameApp::HandleEvents() {
     is_running_ = false;
     return;
   }
+  if (input_manager_->IsActionPressed("profiler_dump")) {
+    engine::utils::Profiler::DumpChromeTrace("profile_" + std::to_string(SDL_GetTicks()) + ".json");
+  }
   scene_manager_->HandleInput();
 }
 void GameApp::Close() {
@@ -132,19 +225,24 @@ void GameApp::Close() {
 }
 bool GameApp::InitSDL() {
   TRACEI(TAG);
+  if (options_.is_headless) {
+    // 无 GPU、无显示器的机器：offscreen 视频驱动 + dummy 音频驱动，渲染器用软件实现
+    SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "offscreen");
+    SDL_SetHint(SDL_HINT_AUDIO_DRIVER, "dummy");
+  }
   if (!SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO)) {
     LOGE(TAG, "Failed to initialize! SDL Error: {}", SDL_GetError());
     return false;
   }
 
   sdl_window_ = SDL_CreateWindow(config_->WindowTitle().c_str(), config_->WindowWidth(), config_->WindowHeight(),
-                                 SDL_WINDOW_RESIZABLE);
+                                 options_.is_headless ? SDL_WINDOW_HIDDEN : SDL_WINDOW_RESIZABLE);
   if (!sdl_window_) {
     LOGE(TAG, "Failed to create window! SDL Error: {}", SDL_GetError());
     return false;
   }
 
-  sdl_renderer_ = SDL_CreateRenderer(sdl_window_, nullptr);
+  sdl_renderer_ = SDL_CreateRenderer(sdl_window_, options_.is_headless ? SDL_SOFTWARE_RENDERER : nullptr);
   if (!sdl_renderer_) {
     LOGE(TAG, "Failed to create renderer! SDL Error: %s", SDL_GetError());
     return false;
@@ -152,8 +250,27 @@ bool GameApp::InitSDL() {
 
   SDL_SetRenderLogicalPresentation(sdl_renderer_, config_->WindowWidth() / 2, config_->WindowHeight() / 2,
                                    SDL_LOGICAL_PRESENTATION_LETTERBOX);
+  vsync_ = ApplyVSync();
   return true;
 }
+int32_t GameApp::ApplyVSync() const {
+  // 基准测试测的是一帧的实际工作量，不能被垂直同步阻塞；无头模式的软件渲染器也没有垂直同步
+  if (options_.IsBenchmark() || options_.is_headless) {
+    SDL_SetRenderVSync(sdl_renderer_, SDL_RENDERER_VSYNC_DISABLED);
+    return SDL_RENDERER_VSYNC_DISABLED;
+  }
+  int32_t vsync = config_->VSync();
+  while (vsync != SDL_RENDERER_VSYNC_DISABLED && !SDL_SetRenderVSync(sdl_renderer_, vsync)) {
+    const int32_t fallback = vsync == 1 ? SDL_RENDERER_VSYNC_DISABLED : 1;
+    LOGW(TAG, "Failed to set vsync {}, fall back to {}. SDL Error: {}", vsync, fallback, SDL_GetError());
+    vsync = fallback;
+  }
+  if (vsync == SDL_RENDERER_VSYNC_DISABLED) {
+    SDL_SetRenderVSync(sdl_renderer_, SDL_RENDERER_VSYNC_DISABLED);
+  }
+  LOGI(TAG, "Renderer vsync: {}", vsync);
+  return vsync;
+}
 bool GameApp::InitResourceManager() {
   TRACEI(TAG);
   try {
@@ -168,13 +285,49 @@ bool GameApp::InitTime() {
   TRACEI(TAG);
   try {
     time_ = std::make_unique<Time>();
-    time_->SetTargetFPS(config_->TargetFps());
+    const int32_t refresh_rate = GetDisplayRefreshRate();
+    time_->SetTargetFPS(config_->UseDisplayRefreshRate() && refresh_rate > 0 ? refresh_rate : config_->TargetFps());
+    if (vsync_ != SDL_RENDERER_VSYNC_DISABLED) {
+      // 刷新率未知时无法判断垂直同步是否在限帧，保持软件限帧
+      time_->SetVSyncRefreshRate(refresh_rate);
+    }
+    time_->SetFixedUpdateFPS(config_->FixedUpdateFps());
+    time_->SetMaxFixedStepsPerFrame(config_->MaxFixedStepsPerFrame());
+    if (options_.IsBenchmark()) {
+      // 基准测试不限帧率，测的是一帧实际要做多少工作
+      time_->SetTargetFPS(0);
+    }
+    time_->SetFixedFrameDelta(options_.fixed_delta_s);
   } catch (const std::exception& e) {
     LOGE(TAG, "Failed to initialize Time! Error: {}", e.what());
     return false;
   }
   return true;
 }
+bool GameApp::InitJobSystem() {
+  TRACEI(TAG);
+  try {
+    job_system_ = std::make_unique<JobSystem>(static_cast<size_t>(config_->WorkerThreads()));
+    if (config_->PipelinedRendering() && job_system_->GetWorkerCount() == 0) {
+      LOGW(TAG, "Pipelined rendering needs at least one worker thread, frames will run serially");
+    }
+  } catch (const std::exception& e) {
+    LOGE(TAG, "Failed to initialize JobSystem! Error: {}", e.what());
+    return false;
+  }
+  return true;
+}
+int32_t GameApp::GetDisplayRefreshRate() const {
+  const SDL_DisplayID display = SDL_GetDisplayForWindow(sdl_window_);
+  const SDL_DisplayMode* mode = display != 0 ? SDL_GetCurrentDisplayMode(display) : nullptr;
+  if (mode == nullptr || mode->refresh_rate <= 0.0f) {
+    LOGW(TAG, "Failed to get display refresh rate. SDL Error: {}", SDL_GetError());
+    return 0;
+  }
+  const auto refresh_rate = static_cast<int32_t>(std::lround(mode->refresh_rate));
+  LOGI(TAG, "Display refresh rate: {}Hz", refresh_rate);
+  return refresh_rate;
+}
 bool GameApp::InitRenderer() {
   TRACEI(TAG);
   try {
@@ -198,7 +351,7 @@ bool GameApp::InitCamera() {
 }
 bool GameApp::InitConfig() {
   TRACEI(TAG);
-  config_ = std::make_unique<Config>("D:/workspace/SunnyLand/assets/config.json");
+  config_ = std::make_unique<Config>(options_.config_path);
   return true;
 }
 bool GameApp::InitInputManager() {
@@ -212,7 +365,8 @@ bool GameApp::InitInputManager() {
 }
 bool GameApp::InitContext() {
   try {
-    context_ = std::make_unique<Context>(*input_manager_, *renderer_, *camera_, *resource_manager_);
+    context_ = std::make_unique<Context>(*input_manager_, *renderer_, *camera_, *resource_manager_, *time_,
+                                         *job_system_);
   } catch (const std::exception& e) {
     LOGE(TAG, "Failed to initialize Context! Error: {}", e.what());
     return false;
@@ -222,6 +376,7 @@ bool GameApp::InitContext() {
 bool GameApp::InitSceneManager() {
   try {
     scene_manager_ = std::make_unique<engine::scene::SceneManager>(*context_);
+    scene_manager_->SetDeferPendingActions(config_->PipelinedRendering());
   } catch (const std::exception& e) {
     LOGE(TAG, "Failed to initialize SceneManager! Error: {}", e.what());
     return false;
@@ -1,5 +1,7 @@
 #pragma once
+#include <cstdint>
 #include <memory>
+#include "launch_options.h"
 
 struct SDL_Window;
 struct SDL_Renderer;
@@ -23,16 +25,19 @@ class SceneManager;
 
 namespace engine::core {
 class Time;
+class JobSystem;
 class Config;
 class Context;
+class BenchmarkRecorder;
 
 class GameApp {
  public:
-  GameApp();
+  explicit GameApp(LaunchOptions options = {});
 
   ~GameApp();
 
-  void Run();
+  // 返回进程退出码：初始化失败或基准测试失败时为 EXIT_FAILURE
+  int Run();
 
   GameApp(const GameApp&) = delete;
 
@@ -46,6 +51,14 @@ class GameApp {
   [[nodiscard]] bool Init();
 
   void Update(double delta_time_s);
+  // 按当前时间模式推进一帧的模拟（可能是 0~N 个固定步）
+  void Simulate();
+  /**
+   * 流水线模式的一帧：模拟任务在工作线程上推进并录制下一帧，主线程同时提交上一帧。
+   * 模拟期间主线程只做渲染提交，所以场景 Update 不能创建纹理——场景用到的纹理应放进 GetPreloadCollector，
+   * 或在 Init 中加载（场景切换在同步点的主线程上执行）。
+   */
+  void RunPipelinedFrame();
 
   void Render();
 
@@ -53,9 +66,16 @@ class GameApp {
 
   void Close();
 
+  /**
+   * 基准测试模式的逐帧推进：先预热到场景推入且预加载完成，再采样 frame_count 帧，写完报告后停止主循环。
+   * 预热超过上限（场景加载失败或卡住）视为失败。
+   */
+  void UpdateBenchmark();
+
   [[nodiscard]] bool InitSDL();
   [[nodiscard]] bool InitResourceManager();
   [[nodiscard]] bool InitTime();
+  [[nodiscard]] bool InitJobSystem();
   [[nodiscard]] bool InitRenderer();
   [[nodiscard]] bool InitCamera();
   [[nodiscard]] bool InitConfig();
@@ -63,11 +83,20 @@ class GameApp {
   [[nodiscard]] bool InitContext();
   [[nodiscard]] bool InitSceneManager();
 
+  // 窗口所在显示器的刷新率，获取失败时返回 0
+  [[nodiscard]] int32_t GetDisplayRefreshRate() const;
+  // 按配置开启垂直同步，驱动不支持时逐级退回（自适应 -> 每帧同步 -> 关闭），返回实际生效的值
+  [[nodiscard]] int32_t ApplyVSync() const;
+
  private:
+  LaunchOptions options_;
+  int exit_code_{0};
   SDL_Window* sdl_window_{nullptr};
   SDL_Renderer* sdl_renderer_{nullptr};
+  int32_t vsync_{0};  // 渲染器实际生效的垂直同步设置
   bool is_running_{true};
   std::unique_ptr<Time> time_{nullptr};
+  std::unique_ptr<JobSystem> job_system_{nullptr};
   std::unique_ptr<engine::resource::ResourceManager> resource_manager_{nullptr};
   std::unique_ptr<engine::render::Camera> camera_{nullptr};
   std::unique_ptr<engine::render::Renderer> renderer_{nullptr};
@@ -75,5 +104,8 @@ class GameApp {
   std::unique_ptr<engine::input::InputManager> input_manager_{nullptr};
   std::unique_ptr<Context> context_{nullptr};
   std::unique_ptr<engine::scene::SceneManager> scene_manager_{nullptr};
+  std::unique_ptr<BenchmarkRecorder> benchmark_recorder_{nullptr};
+  bool is_benchmark_recording_{false};
+  uint32_t benchmark_warmup_frames_{0};
 };
 }  // namespace engine::core
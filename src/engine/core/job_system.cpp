@@ -0,0 +1,127 @@
+#include "job_system.h"
+#include "logger.hpp"
+#include "utils/profiler.h"
+
+namespace engine::core {
+namespace {
+DECLARE_TAG(JobSystem)
+// 当前线程所属的任务系统和队列下标，非工作线程为空
+thread_local const JobSystem* tls_owner = nullptr;
+thread_local size_t tls_queue_index = 0;
+}  // namespace
+
+JobSystem::JobSystem(size_t worker_count) {
+  if (worker_count == 0) {
+    const size_t hardware = std::thread::hardware_concurrency();
+    worker_count = hardware > 1 ? hardware - 1 : 0;
+  }
+  queues_.reserve(worker_count + 1);
+  for (size_t i = 0; i < worker_count + 1; ++i) {
+    queues_.push_back(std::make_unique<WorkQueue>());
+  }
+  workers_.reserve(worker_count);
+  for (size_t i = 0; i < worker_count; ++i) {
+    workers_.emplace_back(&JobSystem::WorkerLoop, this, i);
+  }
+  LOGI(TAG, "JobSystem started with {} worker thread(s)", worker_count);
+}
+
+JobSystem::~JobSystem() {
+  {
+    std::lock_guard lock(sleep_mutex_);
+    is_stopping_ = true;
+  }
+  sleep_cv_.notify_all();
+  for (auto& worker : workers_) {
+    if (worker.joinable()) {
+      worker.join();
+    }
+  }
+  TRACEI(TAG);
+}
+
+void JobSystem::Submit(JobFunction function, void* data, size_t begin, size_t end, JobCounter& counter) {
+  counter.pending.fetch_add(1, std::memory_order_relaxed);
+  auto& queue = *queues_[GetCurrentQueueIndex()];
+  {
+    std::lock_guard lock(queue.mutex);
+    queue.jobs.push_back({function, data, begin, end, &counter});
+  }
+  queued_jobs_.fetch_add(1, std::memory_order_release);
+  // 先经过一次 sleep_mutex_，保证不会在工作线程检查完条件、尚未睡下时漏掉唤醒
+  { std::lock_guard lock(sleep_mutex_); }
+  sleep_cv_.notify_one();
+}
+
+void JobSystem::Wait(JobCounter& counter) {
+  const size_t index = GetCurrentQueueIndex();
+  while (!counter.IsDone()) {
+    Job job;
+    if (TryGetJob(index, job)) {
+      Execute(job);
+    } else {
+      // 剩下的任务都在别的线程手里执行中
+      std::this_thread::yield();
+    }
+  }
+}
+
+void JobSystem::WorkerLoop(size_t index) {
+  tls_owner = this;
+  tls_queue_index = index;
+  engine::utils::Profiler::SetThreadName("Worker " + std::to_string(index));
+  while (true) {
+    Job job;
+    if (TryGetJob(index, job)) {
+      Execute(job);
+      continue;
+    }
+    std::unique_lock lock(sleep_mutex_);
+    sleep_cv_.wait(lock, [this] { return is_stopping_ || queued_jobs_.load(std::memory_order_acquire) > 0; });
+    if (is_stopping_) {
+      return;
+    }
+  }
+}
+
+size_t JobSystem::GetCurrentQueueIndex() const {
+  return tls_owner == this ? tls_queue_index : queues_.size() - 1;
+}
+
+bool JobSystem::TryPop(size_t index, Job& job) {
+  auto& queue = *queues_[index];
+  std::lock_guard lock(queue.mutex);
+  if (queue.jobs.empty()) {
+    return false;
+  }
+  job = queue.jobs.back();
+  queue.jobs.pop_back();
+  queued_jobs_.fetch_sub(1, std::memory_order_relaxed);
+  return true;
+}
+
+bool JobSystem::TrySteal(size_t thief_index, Job& job) {
+  const size_t queue_count = queues_.size();
+  for (size_t offset = 1; offset < queue_count; ++offset) {
+    auto& queue = *queues_[(thief_index + offset) % queue_count];
+    std::lock_guard lock(queue.mutex);
+    if (!queue.jobs.empty()) {
+      job = queue.jobs.front();
+      queue.jobs.pop_front();
+      queued_jobs_.fetch_sub(1, std::memory_order_relaxed);
+      return true;
+    }
+  }
+  return false;
+}
+
+bool JobSystem::TryGetJob(size_t index, Job& job) {
+  return TryPop(index, job) || TrySteal(index, job);
+}
+
+void JobSystem::Execute(const Job& job) {
+  job.function(job.data, job.begin, job.end);
+  job.counter->pending.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+}  // namespace engine::core
@@ -0,0 +1,122 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace engine::core {
+
+/**
+ * @brief 一组任务的完成计数，Wait 等到它归零。
+ */
+struct JobCounter {
+  std::atomic<uint32_t> pending{0};
+
+  [[nodiscard]] bool IsDone() const {
+    return pending.load(std::memory_order_acquire) == 0;
+  }
+};
+
+/**
+ * @brief 引擎级任务系统：固定数量的工作线程，每个线程一个双端队列。
+ * 线程从自己队列的尾部取任务（刚提交的数据还在缓存里），空闲时从其他队列的头部“窃取”，负载自动均衡。
+ * 非工作线程（主线程等）提交的任务进入一个额外的共享队列。
+ * Wait 不会干等，而是边等边执行任务，所以在任务里嵌套 ParallelFor 也不会死锁。
+ *
+ * 任务是函数指针 + 数据指针，不做类型擦除的堆分配；数据的生命周期由调用方保证覆盖到 Wait 返回。
+ */
+class JobSystem final {
+ public:
+  using JobFunction = void (*)(void* data, size_t begin, size_t end);
+
+  // worker_count 为 0 时按硬件线程数减一（留给主线程）
+  explicit JobSystem(size_t worker_count = 0);
+  ~JobSystem();
+
+  // 禁止拷贝和移动
+  JobSystem(const JobSystem&) = delete;
+  JobSystem& operator=(const JobSystem&) = delete;
+  JobSystem(JobSystem&&) = delete;
+  JobSystem& operator=(JobSystem&&) = delete;
+
+  void Submit(JobFunction function, void* data, size_t begin, size_t end, JobCounter& counter);
+  // 等待 counter 归零，期间帮忙执行队列中的任务
+  void Wait(JobCounter& counter);
+
+  /**
+   * @brief 把 [0, count) 切成若干段并行执行 fn(begin, end)，返回时全部完成。
+   * min_batch_size 是每段的最少元素数，元素很轻时调大它以摊薄调度开销。
+   * 没有工作线程或元素太少时直接在当前线程执行。
+   */
+  template <typename Fn>
+  void ParallelFor(size_t count, size_t min_batch_size, Fn&& fn) {
+    if (count == 0) {
+      return;
+    }
+    min_batch_size = std::max<size_t>(min_batch_size, 1);
+    if (workers_.empty() || count <= min_batch_size) {
+      fn(size_t{0}, count);
+      return;
+    }
+    // 段数略多于线程数，给窃取留出均衡的余地
+    const size_t max_batches = (workers_.size() + 1) * kBatchesPerThread;
+    const size_t batch_count = std::min((count + min_batch_size - 1) / min_batch_size, max_batches);
+    const size_t batch_size = (count + batch_count - 1) / batch_count;
+
+    // fn 可能是左值（Fn 推导为引用类型）或 const 对象，按去掉引用后的类型擦除和还原
+    using F = std::remove_reference_t<Fn>;
+    JobCounter counter;
+    const auto invoke = [](void* data, size_t begin, size_t end) { (*static_cast<F*>(data))(begin, end); };
+    void* data = const_cast<void*>(static_cast<const void*>(std::addressof(fn)));
+    for (size_t begin = batch_size; begin < count; begin += batch_size) {
+      Submit(invoke, data, begin, std::min(begin + batch_size, count), counter);
+    }
+    // 第一段由当前线程自己做
+    fn(size_t{0}, std::min(batch_size, count));
+    Wait(counter);
+  }
+
+  [[nodiscard]] size_t GetWorkerCount() const {
+    return workers_.size();
+  }
+
+ private:
+  static constexpr size_t kBatchesPerThread = 4;
+
+  struct Job {
+    JobFunction function = nullptr;
+    void* data = nullptr;
+    size_t begin = 0;
+    size_t end = 0;
+    JobCounter* counter = nullptr;
+  };
+  struct WorkQueue {
+    std::mutex mutex;
+    std::deque<Job> jobs;
+  };
+
+  void WorkerLoop(size_t index);
+  [[nodiscard]] size_t GetCurrentQueueIndex() const;
+  bool TryPop(size_t index, Job& job);
+  bool TrySteal(size_t thief_index, Job& job);
+  bool TryGetJob(size_t index, Job& job);
+  static void Execute(const Job& job);
+
+  // 前 worker_count 个属于工作线程，最后一个是外部线程共用的提交队列
+  std::vector<std::unique_ptr<WorkQueue>> queues_;
+  std::vector<std::thread> workers_;
+
+  std::atomic<size_t> queued_jobs_{0};
+  std::mutex sleep_mutex_;
+  std::condition_variable sleep_cv_;
+  bool is_stopping_ = false;
+};
+
+}  // namespace engine::core
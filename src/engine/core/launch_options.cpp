@@ -0,0 +1,63 @@
+#include "launch_options.h"
+#include "logger.hpp"
+
+#include <charconv>
+#include <string_view>
+
+namespace engine::core {
+namespace {
+DECLARE_TAG(LaunchOptions)
+constexpr const char* kUsage =
+    "usage: SunnyLand [--config FILE] [--headless] [--frames N] [--scene LEVEL] [--fixed-dt SECONDS] [--out FILE]";
+
+template <typename T>
+bool ParseNumber(std::string_view text, T& value) {
+  const auto result = std::from_chars(text.data(), text.data() + text.size(), value);
+  return result.ec == std::errc() && result.ptr == text.data() + text.size();
+}
+}  // namespace
+
+bool LaunchOptions::Parse(int argc, char** argv, LaunchOptions& options) {
+  bool has_config = false;
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg = argv[i];
+    if (arg == "--headless") {
+      options.is_headless = true;
+      continue;
+    }
+    if (i + 1 >= argc) {
+      LOGE(TAG, "Missing value for argument '{}'. {}", arg, kUsage);
+      return false;
+    }
+    const std::string_view value = argv[++i];
+    if (arg == "--config") {
+      options.config_path = value;
+      has_config = true;
+    } else if (arg == "--frames") {
+      if (!ParseNumber(value, options.frame_count)) {
+        LOGE(TAG, "Invalid frame count '{}'. {}", value, kUsage);
+        return false;
+      }
+    } else if (arg == "--scene") {
+      options.scene_path = value;
+    } else if (arg == "--fixed-dt") {
+      if (!ParseNumber(value, options.fixed_delta_s) || options.fixed_delta_s < 0.0) {
+        LOGE(TAG, "Invalid fixed delta '{}'. {}", value, kUsage);
+        return false;
+      }
+    } else if (arg == "--out") {
+      options.output_path = value;
+    } else {
+      LOGE(TAG, "Unknown argument '{}'. {}", arg, kUsage);
+      return false;
+    }
+  }
+  // 基准结果要能复现，不依赖工作目录下恰好有哪份配置和关卡
+  if (options.IsBenchmark() && (!has_config || options.scene_path.empty())) {
+    LOGE(TAG, "Benchmark mode (--frames) requires both --config FILE and --scene LEVEL. {}", kUsage);
+    return false;
+  }
+  return true;
+}
+
+}  // namespace engine::core
@@ -0,0 +1,28 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+namespace engine::core {
+
+/**
+ * @brief 命令行启动参数。
+ * 不带参数时就是正常的窗口游戏；--headless --frames N 组成无窗口、固定帧间隔的基准测试模式。
+ * 默认路径相对于工作目录（仓库根目录或安装目录），基准测试模式必须显式给出 --config 和 --scene。
+ */
+struct LaunchOptions {
+  std::string config_path = "assets/config.json";  // --config FILE：配置文件
+  bool is_headless = false;                        // --headless：offscreen 视频驱动 + 软件渲染器 + dummy 音频
+  uint32_t frame_count = 0;                        // --frames N：采样 N 帧后退出，0 表示一直运行
+  std::string scene_path;                          // --scene PATH：关卡文件，空则使用游戏默认关卡
+  double fixed_delta_s = 0.0;                      // --fixed-dt S：每帧固定推进的时间，0 表示按实测时间
+  std::string output_path;                         // --out FILE：基准报告输出文件，空则打印到标准输出
+
+  [[nodiscard]] bool IsBenchmark() const {
+    return frame_count > 0;
+  }
+
+  // 解析失败（未知参数、缺少值、数值非法）时打印用法并返回 false
+  static bool Parse(int argc, char** argv, LaunchOptions& options);
+};
+
+}  // namespace engine::core
@@ -3,25 +3,33 @@
 
 #include <SDL3/SDL_time.h>
 #include <SDL3/SDL_timer.h>
+#include <algorithm>
+#include <cmath>
 
 namespace engine::core {
 namespace {
 DECLARE_TAG(Time)
 constexpr double kNSPerSec = 1000000000.0;
+// 单帧计入累加器的最长时间，断点调试或窗口拖动后不至于一次积压太多
+constexpr double kMaxFrameDeltaS = 0.25;
+// 连续这么多帧的间隔不到刷新间隔的一半，才认为垂直同步没有在限帧，偶发的快帧不会触发切换
+constexpr uint32_t kVSyncUnpacedFrameLimit = 30;
+// 退回软件限帧后，每隔这么多秒重新交给垂直同步试一次（窗口可能已经恢复可见）
+constexpr int32_t kVSyncRetryIntervalS = 5;
 }  // namespace
 
 Time::Time() : last_time_ns_(SDL_GetTicksNS()), current_frame_start_time_ns_(last_time_ns_) {
   LOGI(TAG, "Init Time: last time is {}", last_time_ns_);
 }
 void Time::Update() {
+  // 先等到本帧的计划开始时刻，再以相邻两帧的开始时刻之差作为帧间隔
+  frame_pacer_.WaitForNextFrame();
   current_frame_start_time_ns_ = SDL_GetTicksNS();
-  auto delta_time_s = static_cast<double>(current_frame_start_time_ns_ - last_time_ns_) / kNSPerSec;
-  if (target_frame_duration_s_ > 0.0) {
-    LimitFrameRate(delta_time_s);
-  } else {
-    delta_time_s_ = delta_time_s;
-  }
-  last_time_ns_ = SDL_GetTicksNS();
+  const uint64_t frame_interval_ns = current_frame_start_time_ns_ - last_time_ns_;
+  delta_time_s_ = fixed_frame_delta_s_ > 0.0 ? fixed_frame_delta_s_
+                                             : static_cast<double>(frame_interval_ns) / kNSPerSec;
+  last_time_ns_ = current_frame_start_time_ns_;
+  CheckVSyncPacing(frame_interval_ns);
 }
 double Time::GetDeltaTimeS() const {
   return time_scale_factor_ * delta_time_s_;
@@ -43,25 +51,135 @@ double Time::GetTimeScale() const {
   return time_scale_factor_;
 }
 void Time::SetTargetFPS(int32_t fps) {
-  if (fps <= 0) {
+  if (fps < 0) {
     LOGW(TAG, "Fps cannot be a negative. Resetting to 0 (unlimit).error value is {}", fps);
-    target_fps_ = 0;
+    fps = 0;
+  }
+  target_fps_ = fps;
+  ApplyPacing();
+}
+
+void Time::SetVSyncRefreshRate(int32_t refresh_rate) {
+  vsync_refresh_rate_ = std::max(refresh_rate, 0);
+  is_vsync_fallback_ = false;
+  unpaced_frames_ = 0;
+  fallback_frames_ = 0;
+  ApplyPacing();
+}
+
+bool Time::IsVSyncPaced() const {
+  return is_vsync_paced_;
+}
+
+bool Time::CanUseVSyncPacing() const {
+  // 目标帧率低于刷新率时垂直同步限不住，仍需软件限帧
+  return vsync_refresh_rate_ > 0 && (target_fps_ == 0 || target_fps_ >= vsync_refresh_rate_);
+}
+
+void Time::ApplyPacing() {
+  is_vsync_paced_ = CanUseVSyncPacing() && !is_vsync_fallback_;
+  if (is_vsync_paced_) {
+    frame_pacer_.SetTargetInterval(0);
+    LOGI(TAG, "Frame rate paced by vsync at {}Hz", vsync_refresh_rate_);
+    return;
+  }
+  // 垂直同步暂时失效时按刷新率限帧，效果与垂直同步相同
+  const int32_t fps = is_vsync_fallback_ && CanUseVSyncPacing() ? vsync_refresh_rate_ : target_fps_;
+  if (fps == 0) {
+    frame_pacer_.SetTargetInterval(0);
+    LOGI(TAG, "Frame rate unlimited");
   } else {
-    target_fps_ = fps;
-    target_frame_duration_s_ = 1.0 / static_cast<double>(target_fps_);
-    LOGI(TAG, "Set FPS {}, target frame duration is {}", target_fps_, target_frame_duration_s_);
+    frame_pacer_.SetTargetInterval(static_cast<uint64_t>(kNSPerSec / static_cast<double>(fps)));
+    LOGI(TAG, "Set FPS {}, target frame interval is {}ns", fps, frame_pacer_.GetTargetInterval());
+  }
+}
+
+void Time::CheckVSyncPacing(uint64_t frame_interval_ns) {
+  if (!CanUseVSyncPacing()) {
+    return;
+  }
+  if (is_vsync_paced_) {
+    const auto refresh_interval_ns = static_cast<uint64_t>(kNSPerSec / static_cast<double>(vsync_refresh_rate_));
+    unpaced_frames_ = frame_interval_ns < refresh_interval_ns / 2 ? unpaced_frames_ + 1 : 0;
+    if (unpaced_frames_ >= kVSyncUnpacedFrameLimit) {
+      LOGI(TAG, "Present is not blocking on vsync, falling back to software pacing");
+      is_vsync_fallback_ = true;
+      unpaced_frames_ = 0;
+      fallback_frames_ = 0;
+      ApplyPacing();
+    }
+  } else if (is_vsync_fallback_ &&
+             ++fallback_frames_ >= static_cast<uint32_t>(vsync_refresh_rate_ * kVSyncRetryIntervalS)) {
+    LOGD(TAG, "Retrying vsync pacing");
+    is_vsync_fallback_ = false;
+    ApplyPacing();
   }
 }
 
+const FramePacerStats& Time::GetFramePacerStats() const {
+  return frame_pacer_.GetStats();
+}
+
 int32_t Time::GetTargetFPS() const {
   return target_fps_;
 }
 
-void Time::LimitFrameRate(double delta_time_s) {
-  if (delta_time_s < target_frame_duration_s_) {
-    auto time_to_wait_ns = static_cast<uint64_t>((target_frame_duration_s_ - delta_time_s) * kNSPerSec);
-    SDL_DelayNS(time_to_wait_ns);
-    delta_time_s_ = static_cast<double>(SDL_GetTicksNS() - last_time_ns_) / kNSPerSec;
+void Time::SetFixedUpdateFPS(int32_t fps) {
+  if (fps <= 0) {
+    fixed_delta_time_s_ = 0.0;
+    LOGI(TAG, "Fixed timestep disabled, simulation runs once per frame");
+  } else {
+    fixed_delta_time_s_ = 1.0 / static_cast<double>(fps);
+    LOGI(TAG, "Fixed timestep enabled, {} updates per second", fps);
+  }
+  accumulator_s_ = 0.0;
+}
+
+bool Time::IsFixedStepEnabled() const {
+  return fixed_delta_time_s_ > 0.0;
+}
+
+double Time::GetFixedDeltaTimeS() const {
+  return fixed_delta_time_s_;
+}
+
+void Time::SetMaxFixedStepsPerFrame(int32_t steps) {
+  if (steps <= 0) {
+    LOGW(TAG, "Max fixed steps per frame must be positive, clamping to 1. error value is {}", steps);
+    steps = 1;
+  }
+  max_fixed_steps_per_frame_ = steps;
+}
+
+int32_t Time::ConsumeFixedSteps() {
+  if (!IsFixedStepEnabled()) {
+    return 0;
+  }
+  // 累加缩放后的时间，时间缩放对固定步长模式同样生效
+  accumulator_s_ += std::min(GetDeltaTimeS(), kMaxFrameDeltaS);
+  auto steps = static_cast<int32_t>(accumulator_s_ / fixed_delta_time_s_);
+  if (steps > max_fixed_steps_per_frame_) {
+    LOGD(TAG, "Simulation fell behind by {} steps, dropping backlog", steps - max_fixed_steps_per_frame_);
+    steps = max_fixed_steps_per_frame_;
+    accumulator_s_ = std::fmod(accumulator_s_, fixed_delta_time_s_);
+  } else {
+    accumulator_s_ -= steps * fixed_delta_time_s_;
+  }
+  return steps;
+}
+
+void Time::SetFixedFrameDelta(double delta_s) {
+  fixed_frame_delta_s_ = std::max(delta_s, 0.0);
+  if (fixed_frame_delta_s_ > 0.0) {
+    LOGI(TAG, "Frame delta fixed at {}s", fixed_frame_delta_s_);
   }
 }
+
+double Time::GetInterpolationAlpha() const {
+  if (!IsFixedStepEnabled()) {
+    return 1.0;
+  }
+  return std::clamp(accumulator_s_ / fixed_delta_time_s_, 0.0, 1.0);
+}
+
 }  // namespace engine::core
\ No newline at end of file
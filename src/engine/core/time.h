@@ -1,5 +1,6 @@
 #pragma once
 #include <cstdint>
+#include "frame_pacer.h"
 
 namespace engine::core {
 class Time {
@@ -21,19 +22,56 @@ class Time {
 
   [[nodiscard]] double GetTimeScale() const;
 
+  // 限帧：fps <= 0 表示不限帧
   void SetTargetFPS(int32_t fps);
   [[nodiscard]] int32_t GetTargetFPS() const;
+  /**
+   * 渲染器已开启垂直同步时传入显示器刷新率，0 表示未开启。
+   * 目标帧率不低于刷新率（或不限帧）时由 SDL_RenderPresent 阻塞限帧，软件限帧器停用，避免两个限帧器叠加；
+   * 检测到呈现没有按刷新率阻塞（窗口被遮挡、驱动强制关闭垂直同步等）时自动切回软件限帧，过一段时间再重新尝试。
+   */
+  void SetVSyncRefreshRate(int32_t refresh_rate);
+  [[nodiscard]] bool IsVSyncPaced() const;
+  [[nodiscard]] const FramePacerStats& GetFramePacerStats() const;
 
- private:
-  void LimitFrameRate(double delta_time_s);
+  // 固定步长模拟：fps <= 0 时关闭，回到每帧一次可变步长的更新
+  void SetFixedUpdateFPS(int32_t fps);
+  [[nodiscard]] bool IsFixedStepEnabled() const;
+  [[nodiscard]] double GetFixedDeltaTimeS() const;
+  // 每帧最多追赶的模拟步数，超出的积压时间直接丢弃，防止越追越慢（spiral of death）
+  void SetMaxFixedStepsPerFrame(int32_t steps);
+  // 取出本帧需要执行的固定步数，每帧在 Update 之后调用一次
+  [[nodiscard]] int32_t ConsumeFixedSteps();
+  // 剩余积压时间占一个步长的比例，渲染时用来在上一步和当前步的状态之间插值；未开启固定步长时为 1
+  [[nodiscard]] double GetInterpolationAlpha() const;
+
+  // 固定帧间隔：> 0 时每帧的 delta 都取这个值而不是实测时间，用于可复现的基准测试；<= 0 恢复实测
+  void SetFixedFrameDelta(double delta_s);
 
  private:
+  // 按目标帧率和垂直同步状态选择限帧方式
+  void ApplyPacing();
+  [[nodiscard]] bool CanUseVSyncPacing() const;
+  // 根据实测帧间隔判断垂直同步是否真的在限帧，必要时切换限帧方式
+  void CheckVSyncPacing(uint64_t frame_interval_ns);
+
   uint64_t last_time_ns_{0};
   uint64_t current_frame_start_time_ns_{0};
   double delta_time_s_{0.0};
   double time_scale_factor_{1.0};
 
   int32_t target_fps_{0};
-  double target_frame_duration_s_{0.0};
+  FramePacer frame_pacer_;
+
+  int32_t vsync_refresh_rate_{0};
+  bool is_vsync_paced_{false};
+  bool is_vsync_fallback_{false};  // 垂直同步没有生效，暂时由软件按刷新率限帧
+  uint32_t unpaced_frames_{0};     // 垂直同步限帧时，连续明显短于刷新间隔的帧数
+  uint32_t fallback_frames_{0};    // 退回软件限帧后经过的帧数
+
+  double fixed_delta_time_s_{0.0};
+  double accumulator_s_{0.0};
+  int32_t max_fixed_steps_per_frame_{5};
+  double fixed_frame_delta_s_{0.0};
 };
 }  // namespace engine::core
\ No newline at end of file
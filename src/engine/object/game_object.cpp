@@ -3,39 +3,120 @@
 #include "input/input_manager.h"
 #include "render/camera.h"
 #include "render/renderer.h"
+#include "scene/scene.h"
+#include "utils/fixed_block_pool.h"
 
 namespace engine::object {
-GameObject::GameObject(const std::string& name, const std::string& tag) : name_(name), tag_(tag) {
+namespace {
+constexpr size_t kGameObjectsPerChunk = 256;
+
+engine::utils::FixedBlockPool& GetGameObjectPool() {
+  static engine::utils::FixedBlockPool pool(sizeof(GameObject), alignof(GameObject), kGameObjectsPerChunk);
+  return pool;
+}
+}  // namespace
+
+GameObject::GameObject(const std::string& name, const std::string& tag)
+    : name_(name), tag_(tag), name_id_(name), tag_id_(tag) {
   spdlog::trace("GameObject created: {} {}", name_, tag_);
 }
 
+GameObject::~GameObject() {
+  for (uint32_t i = 0; i < component_count_; ++i) {
+    DestroyComponent(ordered_components_[i]);
+  }
+}
+
+void GameObject::SetName(const std::string& name) {
+  const auto old_name_id = name_id_;
+  name_ = name;
+  name_id_ = engine::utils::StringId(name);
+  if (scene_ != nullptr && old_name_id != name_id_) {
+    scene_->OnGameObjectNameChanged(this, old_name_id);
+  }
+}
+
+void GameObject::SetTag(const std::string& tag) {
+  const auto old_tag_id = tag_id_;
+  tag_ = tag;
+  tag_id_ = engine::utils::StringId(tag);
+  if (scene_ != nullptr && old_tag_id != tag_id_) {
+    scene_->OnGameObjectTagChanged(this, old_tag_id);
+  }
+}
+
+void GameObject::SetCullable(bool is_cullable) {
+  if (is_cullable_ == is_cullable) {
+    return;
+  }
+  is_cullable_ = is_cullable;
+  if (scene_ != nullptr) {
+    scene_->OnGameObjectCullableChanged(this);
+  }
+}
+
+void GameObject::SetNeedRemove(bool need_remove) {
+  if (need_remove && scene_ != nullptr) {
+    scene_->SafeRemoveGameObject(this);
+    return;
+  }
+  need_remove_ = need_remove;
+}
+
 void GameObject::Update(double delta_time_s, engine::core::Context& context) {
   // 遍历所有组件并调用它们的 update 方法
-  for (auto& pair : components_) {
-    pair.second->Update(delta_time_s, context);
+  for (uint32_t i = 0; i < component_count_; ++i) {
+    ordered_components_[i]->Update(delta_time_s, context);
   }
 }
 
 void GameObject::Render(engine::core::Context& context) {
   // 遍历所有组件并调用它们的 render 方法
-  for (auto& pair : components_) {
-    pair.second->Render(context);
+  for (uint32_t i = 0; i < component_count_; ++i) {
+    ordered_components_[i]->Render(context);
   }
 }
 
 void GameObject::Clean() {
   spdlog::trace("Cleaning GameObject...");
   // 遍历所有组件并调用它们的 clean 方法
-  for (auto& pair : components_) {
-    pair.second->Clean();
+  for (uint32_t i = 0; i < component_count_; ++i) {
+    ordered_components_[i]->Clean();
   }
-  components_.clear();  // 清空 map, unique_ptr 会自动释放内存
+  for (uint32_t i = 0; i < component_count_; ++i) {
+    DestroyComponent(ordered_components_[i]);
+  }
+  ordered_components_.fill(nullptr);
+  component_count_ = 0;
+  components_.fill(nullptr);
+  component_mask_.reset();
 }
 
 void GameObject::HandleInput(engine::core::Context& context) {
   // 遍历所有组件并调用它们的 handleInput 方法
-  for (auto& pair : components_) {
-    pair.second->HandleInput(context);
+  for (uint32_t i = 0; i < component_count_; ++i) {
+    ordered_components_[i]->HandleInput(context);
+  }
+}
+
+void* GameObject::operator new(size_t /*size*/) {
+  // GameObject 是 final，申请的尺寸总是 sizeof(GameObject)
+  return GetGameObjectPool().Allocate();
+}
+
+void GameObject::operator delete(void* ptr) noexcept {
+  if (ptr != nullptr) {
+    GetGameObjectPool().Deallocate(ptr);
+  }
+}
+
+void GameObject::ReleasePoolMemory() {
+  GetGameObjectPool().ReleaseIfUnused();
+}
+
+void GameObject::DestroyComponent(engine::component::Component* component) {
+  if (component != nullptr && component->storage_ != nullptr) {
+    component->storage_->Destroy(component);
   }
 }
 
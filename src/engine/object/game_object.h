@@ -1,25 +1,43 @@
 #pragma once
 #include "component/component.h"
+#include "component/component_storage.h"
+#include "component/component_type_id.h"
+#include "game_object_handle.h"
+#include "utils/string_id.h"
 #include "logger.hpp"
 
 #include <spdlog/spdlog.h>
+#include <algorithm>
+#include <array>
+#include <bitset>
 #include <memory>
-#include <typeindex>
-#include <unordered_map>
 #include <utility>
 
 namespace engine::core {
 class Context;
 }  // namespace engine::core
 
+namespace engine::scene {
+class Scene;
+}  // namespace engine::scene
+
 namespace engine::object {
 namespace {
 DECLARE_TAG(GameObject);
 }  // namespace
 
 class GameObject final {
+  friend class engine::scene::Scene;
+
  public:
   explicit GameObject(const std::string& name = "", const std::string& tag = "");
+  ~GameObject();
+
+  // 对象内存来自定长块池，std::make_unique<GameObject> 等照常使用，不经过全局堆
+  static void* operator new(size_t size);
+  static void operator delete(void* ptr) noexcept;
+  // 池中没有存活对象时整体释放内存，Scene::Clean 之后调用
+  static void ReleasePoolMemory();
 
   // 禁止拷贝和移动，确保唯一性 (通常游戏对象不应随意拷贝)
   GameObject(const GameObject&) = delete;
@@ -28,73 +46,106 @@ class GameObject final {
   GameObject& operator=(GameObject&&) = delete;
 
   // setters and getters
-  void SetName(const std::string& name) {
-    name_ = name;
-  }
+  // 修改名字/标签时会同步更新所属场景的索引
+  void SetName(const std::string& name);
   [[nodiscard]] const std::string& GetName() const {
     return name_;
   }
-  void SetTag(const std::string& tag) {
-    tag_ = tag;
+  [[nodiscard]] engine::utils::StringId GetNameId() const {
+    return name_id_;
   }
+  void SetTag(const std::string& tag);
   [[nodiscard]] const std::string& GetTag() const {
     return tag_;
   }
-  void SetNeedRemove(bool need_remove) {
-    need_remove_ = need_remove;
+  [[nodiscard]] engine::utils::StringId GetTagId() const {
+    return tag_id_;
   }
+  // 标记移除：已在场景中的对象会登记到场景的待移除列表，在本帧末尾统一清理
+  void SetNeedRemove(bool need_remove);
   [[nodiscard]] bool IsNeedRemove() const {
     return need_remove_;
   }
+  // 所属场景，由 Scene::AddGameObject 设置；场景按它筛选需要批量更新的组件
+  void SetScene(engine::scene::Scene* scene) {
+    scene_ = scene;
+  }
+  [[nodiscard]] engine::scene::Scene* GetScene() const {
+    return scene_;
+  }
+  // 对象的绘制完全落在变换组件登记的包围盒内时为 true（由 SpriteComponent 设置），场景渲染时按相机视口剔除
+  void SetCullable(bool is_cullable);
+  [[nodiscard]] bool IsCullable() const {
+    return is_cullable_;
+  }
+  // 加入场景后才有效，可跨帧持有，通过 Scene::GetGameObject 解析
+  [[nodiscard]] GameObjectHandle GetHandle() const {
+    return handle_;
+  }
 
   template <typename T, typename... Args>
   T* AddComponent(Args&&... args) {
     // 检测组件是否合法。  /*  static_assert(condition, message)：静态断言，在编译期检测，无任何性能影响 */
     /* std::is_base_of<Base, Derived>::value -- 判断 Base 类型是否是 Derived 类型的基类 */
     static_assert(std::is_base_of_v<engine::component::Component, T>, "T 必须继承自 Component");
-    // 获取类型标识。     /* typeid(T) -- 用于获取一个表达式或类型的运行时类型信息 (RTTI), 返回 std::type_info& */
-    /* std::type_index -- 针对std::type_info对象的包装器，主要设计用来作为关联容器（如 std::map）的键。*/
-    const auto type_index = std::type_index(typeid(T));
+    // 获取类型标识：每种组件一个从 0 开始的编号，直接作为组件表下标
+    const auto type_id = engine::component::GetComponentTypeId<T>();
+    if (type_id >= engine::component::kMaxComponentTypes) {
+      LOGE(TAG, "GameObject::AddComponent: too many component types, increase kMaxComponentTypes ({})",
+           engine::component::kMaxComponentTypes);
+      return nullptr;
+    }
     // 如果组件已经存在，则直接返回组件指针
-    if (HasComponent<T>()) {
-      return GetComponent<T>();
+    if (component_mask_.test(type_id)) {
+      return static_cast<T*>(components_[type_id]);
     }
-    // 如果不存在则创建组件     /* std::forward -- 用于实现完美转发。传递多个参数的时候使用...标识 */
-    auto new_component = std::make_unique<T>(std::forward<Args>(args)...);
-    T* ptr = new_component.get();
-    new_component->SetOwner(this);
-    components_[type_index] = std::move(new_component);
+    // 如果不存在则在该类型的组件存储中创建     /* std::forward -- 用于实现完美转发。传递多个参数的时候使用...标识 */
+    T* ptr = engine::component::ComponentStorage<T>::Instance().Create(std::forward<Args>(args)...);
+    ptr->SetOwner(this);
+    components_[type_id] = ptr;
+    component_mask_.set(type_id);
+    ordered_components_[component_count_++] = ptr;
     ptr->Init();
-    LOGD(TAG, "GameObject::AddComponent: {} added component {}", name_, typeid(T).name());
+    LOGD(TAG, "GameObject::AddComponent: {} added component {}", name_,
+         engine::component::GetComponentTypeName<T>());
     return ptr;
   }
 
   template <typename T>
   T* GetComponent() const {
     static_assert(std::is_base_of_v<engine::component::Component, T>, "T 必须继承自 Component");
-    const auto type_index = std::type_index(typeid(T));
-    if (const auto it = components_.find(type_index); it != components_.end()) {
-      // 返回unique_ptr的裸指针。(肯定是T类型, static_cast其实并无必要，但保留可以使我们意图更清晰)
-      return static_cast<T*>(it->second.get());
+    const auto type_id = engine::component::GetComponentTypeId<T>();
+    if (type_id >= engine::component::kMaxComponentTypes) {
+      return nullptr;
     }
-    return nullptr;
+    // 未添加的槽位为 nullptr；存储的是基类指针，转换回 T
+    return static_cast<T*>(components_[type_id]);
   }
 
   template <typename T>
   [[nodiscard]] bool HasComponent() const {
     static_assert(std::is_base_of_v<engine::component::Component, T>, "T 必须继承自 Component");
-    // contains方法为 C++20 新增
-    return components_.contains(std::type_index(typeid(T)));
+    const auto type_id = engine::component::GetComponentTypeId<T>();
+    return type_id < engine::component::kMaxComponentTypes && component_mask_.test(type_id);
   }
 
   template <typename T>
   void RemoveComponent() {
     static_assert(std::is_base_of_v<engine::component::Component, T>, "T 必须继承自 Component");
-    const auto type_index = std::type_index(typeid(T));
-    if (const auto it = components_.find(type_index); it != components_.end()) {
-      it->second->Clean();
-      components_.erase(it);
+    if (!HasComponent<T>()) {
+      return;
     }
+    const auto type_id = engine::component::GetComponentTypeId<T>();
+    engine::component::Component* component = components_[type_id];
+    component->Clean();
+    // 保持剩余组件的添加顺序
+    const auto end = ordered_components_.begin() + component_count_;
+    const auto it = std::find(ordered_components_.begin(), end, component);
+    std::move(it + 1, end, it);
+    ordered_components_[--component_count_] = nullptr;
+    components_[type_id] = nullptr;
+    component_mask_.reset(type_id);
+    DestroyComponent(component);
   }
 
   // 关键循环函数
@@ -103,11 +154,31 @@ class GameObject final {
   void Clean();
   void HandleInput(engine::core::Context& context);
 
+ private:
+  // 把组件归还给它所在的 ComponentStorage
+  static void DestroyComponent(engine::component::Component* component);
+
  private:
   std::string name_;
   std::string tag_;
-  std::unordered_map<std::type_index, std::unique_ptr<engine::component::Component>> components_;
+  engine::utils::StringId name_id_;
+  engine::utils::StringId tag_id_;
+  // 组件本体由 ComponentStorage 持有，这里按类型 id 索引
+  std::array<engine::component::Component*, engine::component::kMaxComponentTypes> components_{};
+  std::bitset<engine::component::kMaxComponentTypes> component_mask_;
+  // 添加顺序，供逐对象遍历；定长数组避免每个对象一次额外的堆分配
+  std::array<engine::component::Component*, engine::component::kMaxComponentTypes> ordered_components_{};
+  uint32_t component_count_ = 0;
+
+  engine::scene::Scene* scene_ = nullptr;
+  // 以下由 Scene 维护：在场景对象数组中的下标和句柄
+  uint32_t scene_index_ = 0;
+  uint32_t name_index_slot_ = 0;  // 在场景名字索引桶中的位置
+  uint32_t tag_index_slot_ = 0;   // 在场景标签索引桶中的位置
+  uint32_t unculled_slot_ = 0;    // 不可剔除时在场景常驻渲染列表中的位置
+  GameObjectHandle handle_;
   bool need_remove_ = false;
+  bool is_cullable_ = false;
 };
 
 }  // namespace engine::object
\ No newline at end of file
@@ -0,0 +1,25 @@
+#pragma once
+#include <cstdint>
+#include <limits>
+
+namespace engine::object {
+
+/**
+ * @brief 游戏对象句柄：指向 Scene 句柄表的代际索引。
+ * 对象被移除后槽位的 generation 递增，旧句柄随之失效，Scene::GetGameObject 返回 nullptr，
+ * 因此可以跨帧安全地持有句柄，而不必担心悬空指针。
+ */
+struct GameObjectHandle {
+  static constexpr uint32_t kInvalidIndex = std::numeric_limits<uint32_t>::max();
+
+  uint32_t index = kInvalidIndex;
+  uint32_t generation = 0;
+
+  [[nodiscard]] bool IsValid() const {
+    return index != kInvalidIndex;
+  }
+
+  friend bool operator==(const GameObjectHandle&, const GameObjectHandle&) = default;
+};
+
+}  // namespace engine::object
@@ -0,0 +1,262 @@
+#include "render_queue.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <numbers>
+
+#include "logger.hpp"
+
+namespace engine::render {
+namespace {
+DECLARE_TAG(RenderQueue);
+constexpr SDL_FColor kWhite = {1.0f, 1.0f, 1.0f, 1.0f};
+// 排序范围小于这个数量时直接比较排序，基数排序的计数开销不划算
+constexpr size_t kRadixSortThreshold = 64;
+// 排序键：高 16 位 layer，中间 16 位纹理指针折叠值，低 32 位 depth
+
+// 有符号整数加偏置后按无符号比较即为原顺序
+uint64_t EncodeLayer(int32_t layer) {
+  const int32_t clamped = std::clamp<int32_t>(layer, std::numeric_limits<int16_t>::min(),
+                                              std::numeric_limits<int16_t>::max());
+  return static_cast<uint16_t>(clamped - std::numeric_limits<int16_t>::min());
+}
+
+// 纹理只需要把相同的聚到一起，不关心先后：直接把指针折叠成 16 位，不查表也不分配。
+// 两个纹理折叠值相同的概率很低，碰上了也只是这两个纹理交错、多出几次绘制调用，layer 顺序不受影响
+uint64_t EncodeTexture(const SDL_Texture* texture) {
+  const auto bits = reinterpret_cast<uintptr_t>(texture) >> 4;  // 堆分配至少 16 字节对齐，低位恒为 0
+  return static_cast<uint16_t>(bits ^ (bits >> 16) ^ (bits >> 32));
+}
+
+// 浮点数的保序编码：正数翻转符号位，负数翻转全部位
+uint64_t EncodeDepth(float depth) {
+  const auto bits = std::bit_cast<uint32_t>(depth == 0.0f ? 0.0f : depth);
+  return (bits & 0x80000000u) != 0 ? ~bits : bits | 0x80000000u;
+}
+}  // namespace
+
+void RenderQueue::Push(const SpriteDrawCommand& command) {
+  commands_.push_back(command);
+}
+
+void RenderQueue::PushGeometry(SDL_Texture* texture, const std::vector<SDL_Vertex>& vertices,
+                               const std::vector<int>& indices) {
+  CloseSortScope();
+  if (vertices.empty()) {
+    return;
+  }
+  segments_.push_back({SegmentType::GEOMETRY, texture, static_cast<uint32_t>(geometry_vertices_.size()),
+                       static_cast<uint32_t>(vertices.size()), static_cast<uint32_t>(geometry_indices_.size()),
+                       static_cast<uint32_t>(indices.size())});
+  geometry_vertices_.insert(geometry_vertices_.end(), vertices.begin(), vertices.end());
+  geometry_indices_.insert(geometry_indices_.end(), indices.begin(), indices.end());
+}
+
+void RenderQueue::PushWrappedQuad(SDL_Texture* texture, const SDL_FRect& dst_rect, const SDL_FRect& uv_rect,
+                                  bool is_wrap_u, bool is_wrap_v) {
+  CloseSortScope();
+  const auto vertex_begin = static_cast<uint32_t>(geometry_vertices_.size());
+  const auto index_begin = static_cast<uint32_t>(geometry_indices_.size());
+  const float x1 = dst_rect.x + dst_rect.w;
+  const float y1 = dst_rect.y + dst_rect.h;
+  const float u1 = uv_rect.x + uv_rect.w;
+  const float v1 = uv_rect.y + uv_rect.h;
+  // 左上、右上、右下、左下；几何段的索引相对本段第一个顶点
+  geometry_vertices_.push_back({{dst_rect.x, dst_rect.y}, kWhite, {uv_rect.x, uv_rect.y}});
+  geometry_vertices_.push_back({{x1, dst_rect.y}, kWhite, {u1, uv_rect.y}});
+  geometry_vertices_.push_back({{x1, y1}, kWhite, {u1, v1}});
+  geometry_vertices_.push_back({{dst_rect.x, y1}, kWhite, {uv_rect.x, v1}});
+  geometry_indices_.insert(geometry_indices_.end(), {0, 1, 2, 0, 2, 3});
+  segments_.push_back({SegmentType::GEOMETRY, texture, vertex_begin, 4, index_begin, 6, is_wrap_u, is_wrap_v});
+}
+
+void RenderQueue::CloseSortScope() {
+  if (commands_.size() == scope_begin_) {
+    return;
+  }
+  // 排序在录制方完成，不占用渲染线程
+  SortScope();
+  segments_.push_back({SegmentType::SPRITES, nullptr, static_cast<uint32_t>(scope_begin_),
+                       static_cast<uint32_t>(commands_.size() - scope_begin_), 0, 0});
+  scope_begin_ = commands_.size();
+}
+
+uint64_t RenderQueue::MakeSortKey(const SpriteDrawCommand& command) {
+  return EncodeLayer(command.layer) << 48 | EncodeTexture(command.texture) << 32 | EncodeDepth(command.depth);
+}
+
+void RenderQueue::SortScope() {
+  const size_t count = commands_.size() - scope_begin_;
+  if (count < 2) {
+    return;
+  }
+  sort_entries_.clear();
+  uint64_t all_bits = ~uint64_t{0};
+  uint64_t any_bits = 0;
+  for (size_t i = 0; i < count; ++i) {
+    const uint64_t key = MakeSortKey(commands_[scope_begin_ + i]);
+    sort_entries_.emplace_back(key, static_cast<uint32_t>(i));
+    all_bits &= key;
+    any_bits |= key;
+  }
+
+  if (count < kRadixSortThreshold) {
+    std::stable_sort(sort_entries_.begin(), sort_entries_.end(),
+                     [](const auto& a, const auto& b) { return a.first < b.first; });
+  } else {
+    // LSD 基数排序，每趟 8 位，天然稳定；所有键在某一字节上相同的趟直接跳过（如只用一个 layer、depth 全为 0）
+    const uint64_t varying_bits = all_bits ^ any_bits;
+    sort_scratch_.resize(count);
+    for (uint32_t shift = 0; shift < 64; shift += 8) {
+      if (((varying_bits >> shift) & 0xFF) == 0) {
+        continue;
+      }
+      std::array<uint32_t, 256> offsets{};
+      for (const auto& entry : sort_entries_) {
+        ++offsets[(entry.first >> shift) & 0xFF];
+      }
+      uint32_t total = 0;
+      for (auto& offset : offsets) {
+        const uint32_t bucket_count = offset;
+        offset = total;
+        total += bucket_count;
+      }
+      for (const auto& entry : sort_entries_) {
+        sort_scratch_[offsets[(entry.first >> shift) & 0xFF]++] = entry;
+      }
+      sort_entries_.swap(sort_scratch_);
+    }
+  }
+
+  sorted_commands_.clear();
+  for (const auto& entry : sort_entries_) {
+    sorted_commands_.push_back(commands_[scope_begin_ + entry.second]);
+  }
+  std::copy(sorted_commands_.begin(), sorted_commands_.end(),
+            commands_.begin() + static_cast<std::ptrdiff_t>(scope_begin_));
+}
+
+void RenderQueue::Submit(SDL_Renderer* renderer) {
+  CloseSortScope();
+  stats_ = {};
+  for (const auto& segment : segments_) {
+    if (segment.type == SegmentType::SPRITES) {
+      SubmitSprites(renderer, segment);
+    } else {
+      SubmitGeometry(renderer, segment);
+    }
+  }
+}
+
+void RenderQueue::Clear() {
+  commands_.clear();
+  scope_begin_ = 0;
+  segments_.clear();
+  geometry_vertices_.clear();
+  geometry_indices_.clear();
+}
+
+void RenderQueue::SubmitSprites(SDL_Renderer* renderer, const Segment& segment) {
+  const size_t segment_end = segment.begin + segment.count;
+  size_t batch_begin = segment.begin;
+  while (batch_begin < segment_end) {
+    SDL_Texture* texture = commands_[batch_begin].texture;
+    size_t batch_end = batch_begin;
+    while (batch_end < segment_end && commands_[batch_end].texture == texture) {
+      ++batch_end;
+    }
+
+    float texture_w = 0.0f;
+    float texture_h = 0.0f;
+    if (!SDL_GetTextureSize(texture, &texture_w, &texture_h) || texture_w <= 0.0f || texture_h <= 0.0f) {
+      LOGE(TAG, "Failed to get texture size: {}!", SDL_GetError());
+      batch_begin = batch_end;
+      continue;
+    }
+
+    vertices_.clear();
+    indices_.clear();
+    for (size_t i = batch_begin; i < batch_end; ++i) {
+      AppendQuad(commands_[i], texture_w, texture_h);
+    }
+
+    if (!SDL_RenderGeometry(renderer, texture, vertices_.data(), static_cast<int>(vertices_.size()), indices_.data(),
+                            static_cast<int>(indices_.size()))) {
+      LOGE(TAG, "Failed to render sprite batch ({} sprites): {}!", batch_end - batch_begin, SDL_GetError());
+    }
+    ++stats_.draw_calls;
+    stats_.sprites += static_cast<uint32_t>(batch_end - batch_begin);
+    stats_.vertices += static_cast<uint32_t>(vertices_.size());
+    batch_begin = batch_end;
+  }
+}
+
+void RenderQueue::SubmitGeometry(SDL_Renderer* renderer, const Segment& segment) {
+#if SUNNYLAND_HAS_TEXTURE_WRAP
+  const bool is_wrapped = segment.is_wrap_u || segment.is_wrap_v;
+  if (is_wrapped && !SDL_SetRenderTextureAddressMode(
+                        renderer, segment.is_wrap_u ? SDL_TEXTURE_ADDRESS_WRAP : SDL_TEXTURE_ADDRESS_CLAMP,
+                        segment.is_wrap_v ? SDL_TEXTURE_ADDRESS_WRAP : SDL_TEXTURE_ADDRESS_CLAMP)) {
+    LOGE(TAG, "Failed to set texture address mode: {}!", SDL_GetError());
+  }
+#endif
+  const int* indices = segment.index_count > 0 ? geometry_indices_.data() + segment.index_begin : nullptr;
+  if (!SDL_RenderGeometry(renderer, segment.texture, geometry_vertices_.data() + segment.begin,
+                          static_cast<int>(segment.count), indices, static_cast<int>(segment.index_count))) {
+    LOGE(TAG, "Failed to render geometry: {}!", SDL_GetError());
+  }
+#if SUNNYLAND_HAS_TEXTURE_WRAP
+  // 寻址模式是渲染器状态，恢复默认以免影响之后的绘制
+  if (is_wrapped) {
+    SDL_SetRenderTextureAddressMode(renderer, SDL_TEXTURE_ADDRESS_AUTO, SDL_TEXTURE_ADDRESS_AUTO);
+  }
+#endif
+  ++stats_.draw_calls;
+  stats_.vertices += segment.count;
+}
+
+void RenderQueue::AppendQuad(const SpriteDrawCommand& command, float texture_w, float texture_h) {
+  const SDL_FRect& src = command.src_rect;
+  const SDL_FRect& dst = command.dst_rect;
+
+  float u0 = src.x / texture_w;
+  float u1 = (src.x + src.w) / texture_w;
+  const float v0 = src.y / texture_h;
+  const float v1 = (src.y + src.h) / texture_h;
+  if (command.is_flipped) {
+    std::swap(u0, u1);
+  }
+
+  // 以矩形中心为原点的四个角：左上、右上、右下、左下
+  const float half_w = dst.w * 0.5f;
+  const float half_h = dst.h * 0.5f;
+  const float center_x = dst.x + half_w;
+  const float center_y = dst.y + half_h;
+  const SDL_FPoint corners[4] = {{-half_w, -half_h}, {half_w, -half_h}, {half_w, half_h}, {-half_w, half_h}};
+  const SDL_FPoint uvs[4] = {{u0, v0}, {u1, v0}, {u1, v1}, {u0, v1}};
+
+  // 与 SDL_RenderTextureRotated 一致：屏幕坐标系 y 轴向下，正角度为顺时针
+  float sin_a = 0.0f;
+  float cos_a = 1.0f;
+  if (command.angle != 0.0f) {
+    const float radians = command.angle * std::numbers::pi_v<float> / 180.0f;
+    sin_a = std::sin(radians);
+    cos_a = std::cos(radians);
+  }
+
+  const int base = static_cast<int>(vertices_.size());
+  for (int i = 0; i < 4; ++i) {
+    SDL_Vertex vertex;
+    vertex.position.x = center_x + corners[i].x * cos_a - corners[i].y * sin_a;
+    vertex.position.y = center_y + corners[i].x * sin_a + corners[i].y * cos_a;
+    vertex.color = kWhite;
+    vertex.tex_coord = uvs[i];
+    vertices_.push_back(vertex);
+  }
+  indices_.insert(indices_.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+}
+
+}  // namespace engine::render
@@ -0,0 +1,119 @@
+// render_queue.h
+#pragma once
+#include <SDL3/SDL_rect.h>
+#include <SDL3/SDL_render.h>
+#include <SDL3/SDL_version.h>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// SDL 3.4 起可以设置几何绘制的纹理寻址模式，平铺纹理用一个 UV 超出 [0, 1] 的四边形就能画完
+#if SDL_VERSION_ATLEAST(3, 4, 0)
+#define SUNNYLAND_HAS_TEXTURE_WRAP 1
+#else
+#define SUNNYLAND_HAS_TEXTURE_WRAP 0
+#endif
+
+namespace engine::render {
+
+/**
+ * @brief 一条精灵绘制命令，只保留提交到 GPU 所需的最少信息。
+ * dst_rect 已经是屏幕坐标，angle 为顺时针角度，绕 dst_rect 中心旋转。
+ * 同一排序范围内按 (layer, texture, depth) 升序绘制：layer 决定上下层；depth 只在同一纹理（图集页）内排序，
+ * 相同的命令保持录制顺序。
+ */
+struct SpriteDrawCommand {
+  SDL_Texture* texture = nullptr;
+  SDL_FRect src_rect = {0.0f, 0.0f, 0.0f, 0.0f};
+  SDL_FRect dst_rect = {0.0f, 0.0f, 0.0f, 0.0f};
+  float angle = 0.0f;
+  int32_t layer = 0;
+  bool is_flipped = false;
+  float depth = 0.0f;
+};
+
+/**
+ * @brief 一帧提交的统计，draw_calls 为实际发出的 SDL_RenderGeometry 次数。
+ */
+struct RenderStats {
+  uint32_t draw_calls = 0;
+  uint32_t sprites = 0;
+  uint32_t vertices = 0;
+};
+
+/**
+ * @brief 一帧的渲染命令录制。
+ * 录制阶段不调用 SDL 渲染接口：精灵推入当前排序范围，CloseSortScope 时按 64 位排序键基数排序；
+ * 立即几何（如瓦片分块）拷贝进队列自己的缓冲，作为单独的一段保持录制顺序。
+ * Submit 时按段回放，同一纹理的连续精灵合并成一次 SDL_RenderGeometry 调用。
+ * 录制和提交可以发生在不同线程，只要同一时刻只有一方在使用这个队列。
+ */
+class RenderQueue final {
+ public:
+  RenderQueue() = default;
+
+  // 禁用拷贝和移动语义
+  RenderQueue(const RenderQueue&) = delete;
+  RenderQueue& operator=(const RenderQueue&) = delete;
+  RenderQueue(RenderQueue&&) = delete;
+  RenderQueue& operator=(RenderQueue&&) = delete;
+
+  void Push(const SpriteDrawCommand& command);
+  // 关闭当前排序范围后追加一段几何，顶点为屏幕坐标
+  void PushGeometry(SDL_Texture* texture, const std::vector<SDL_Vertex>& vertices, const std::vector<int>& indices);
+  // 关闭当前排序范围后追加一个轴对齐四边形，uv_rect 以整张纹理为单位，可超出 [0, 1]；
+  // is_wrap_u/v 为 true 的方向按重复寻址，否则按夹取寻址。只在 SUNNYLAND_HAS_TEXTURE_WRAP 时可用
+  void PushWrappedQuad(SDL_Texture* texture, const SDL_FRect& dst_rect, const SDL_FRect& uv_rect, bool is_wrap_u,
+                       bool is_wrap_v);
+  // 结束当前排序范围：之后录制的绘制一定位于之前所有绘制的上方
+  void CloseSortScope();
+  // 按录制顺序提交，只能在渲染线程调用；不清空录制内容
+  void Submit(SDL_Renderer* renderer);
+  void Clear();
+
+  [[nodiscard]] bool IsEmpty() const {
+    return segments_.empty() && commands_.size() == scope_begin_;
+  }
+  // 最近一次 Submit 的统计
+  [[nodiscard]] const RenderStats& GetStats() const {
+    return stats_;
+  }
+
+ private:
+  enum class SegmentType : uint8_t { SPRITES, GEOMETRY };
+  // SPRITES 段引用 commands_ 的 [begin, begin + count)；GEOMETRY 段引用几何缓冲的顶点和索引区间
+  struct Segment {
+    SegmentType type = SegmentType::SPRITES;
+    SDL_Texture* texture = nullptr;
+    uint32_t begin = 0;
+    uint32_t count = 0;
+    uint32_t index_begin = 0;
+    uint32_t index_count = 0;
+    bool is_wrap_u = false;
+    bool is_wrap_v = false;
+  };
+
+  void SubmitSprites(SDL_Renderer* renderer, const Segment& segment);
+  void SubmitGeometry(SDL_Renderer* renderer, const Segment& segment);
+  void AppendQuad(const SpriteDrawCommand& command, float texture_w, float texture_h);
+  // 对 [scope_begin_, end) 的命令按排序键稳定排序
+  void SortScope();
+  [[nodiscard]] static uint64_t MakeSortKey(const SpriteDrawCommand& command);
+
+ private:
+  std::vector<SpriteDrawCommand> commands_;
+  size_t scope_begin_ = 0;  // 当前未关闭的排序范围在 commands_ 中的起点
+  std::vector<Segment> segments_;
+  // 排序用的缓冲，每帧复用：(排序键, 命令下标) 及其基数排序的交换区、按新顺序重排的命令
+  std::vector<std::pair<uint64_t, uint32_t>> sort_entries_;
+  std::vector<std::pair<uint64_t, uint32_t>> sort_scratch_;
+  std::vector<SpriteDrawCommand> sorted_commands_;
+  std::vector<SDL_Vertex> geometry_vertices_;
+  std::vector<int> geometry_indices_;
+  // 提交时合批用的顶点/索引缓冲，每帧复用，避免重复分配
+  std::vector<SDL_Vertex> vertices_;
+  std::vector<int> indices_;
+  RenderStats stats_;
+};
+
+}  // namespace engine::render
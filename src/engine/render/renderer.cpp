@@ -5,6 +5,7 @@
 #include "camera.h"
 #include "logger.hpp"
 #include "resource/resource_manager.h"
+#include "utils/profiler.h"
 namespace engine::render {
 namespace {
 DECLARE_TAG(Renderer);
@@ -18,17 +19,24 @@ Renderer::Renderer(SDL_Renderer* sdl_renderer, engine::resource::ResourceManager
   if (resource_manager_ == nullptr) {
     throw std::runtime_error("ResourceManager could not initialize");
   }
+#if SUNNYLAND_HAS_TEXTURE_WRAP
+  // 部分后端只能对 2 的幂尺寸的纹理重复寻址，其余尺寸会被夹取或拉伸，这时视差背景仍逐块平铺
+  is_texture_wrap_supported_ = SDL_GetBooleanProperty(SDL_GetRendererProperties(renderer_),
+                                                      SDL_PROP_RENDERER_TEXTURE_WRAPPING_BOOLEAN, false);
+  LOGI(TAG, "Renderer texture wrapping: {}", is_texture_wrap_supported_ ? "supported" : "unsupported");
+#endif
 }
 
 void Renderer::DrawSprite(const Camera& camera, const Sprite& sprite, const glm::vec2& position, const glm::vec2& scale,
-                          double angle) const {
-  auto texture = resource_manager_->GetTexture(sprite.GetTextureId());
-  if (texture == nullptr) {
+                          double angle, int32_t layer, float depth) {
+  PROFILE_SCOPE("Renderer::DrawSprite");
+  const auto region = ResolveTextureRegion(sprite);
+  if (region.texture == nullptr) {
     LOGE(TAG, "Failed to get texture for {}!", sprite.GetTextureId());
     return;
   }
 
-  auto src_rect = GetSpriteSrcRect(sprite);
+  auto src_rect = GetSpriteSrcRect(sprite, region);
   if (!src_rect.has_value()) {
     LOGE(TAG, "Failed to get source rect for {}!", sprite.GetTextureId());
     return;
@@ -40,21 +48,41 @@ void Renderer::DrawSprite(const Camera& camera, const Sprite& sprite, const glm:
   if (!IsRectInViewport(camera, dst_rect)) {
     return;
   }
-  if (!SDL_RenderTextureRotated(renderer_, texture, &src_rect.value(), &dst_rect, angle, nullptr,
-                                sprite.IsFlipped() ? SDL_FLIP_HORIZONTAL : SDL_FLIP_VERTICAL)) {
-    LOGE(TAG, "Failed to render texture for {}!", sprite.GetTextureId());
+  GetRecordingQueue().Push(
+      {region.texture, src_rect.value(), dst_rect, static_cast<float>(angle), layer, sprite.IsFlipped(), depth});
+}
+
+void Renderer::DrawSprite(const Camera& camera, const Sprite& sprite, const SDL_FRect& world_rect, float angle,
+                          int32_t layer, float depth) {
+  PROFILE_SCOPE("Renderer::DrawSprite");
+  // 先做视口裁剪，视口外的精灵连纹理都不用查
+  const glm::vec2 position_screen = camera.WorldToScreen({world_rect.x, world_rect.y});
+  const SDL_FRect dst_rect = {position_screen.x, position_screen.y, world_rect.w, world_rect.h};
+  if (!IsRectInViewport(camera, dst_rect)) {
+    return;
+  }
+  const auto region = ResolveTextureRegion(sprite);
+  if (region.texture == nullptr) {
+    LOGE(TAG, "Failed to get texture for {}!", sprite.GetTextureId());
+    return;
+  }
+  const auto src_rect = GetSpriteSrcRect(sprite, region);
+  if (!src_rect.has_value()) {
+    LOGE(TAG, "Failed to get source rect for {}!", sprite.GetTextureId());
     return;
   }
+  GetRecordingQueue().Push({region.texture, src_rect.value(), dst_rect, angle, layer, sprite.IsFlipped(), depth});
 }
 void Renderer::DrawParallax(const Camera& camera, const Sprite& sprite, const glm::vec2& position,
-                            const glm::vec2& scroll_factor, const glm::bvec2& repeat, const glm::vec2& scale) const {
-  const auto texture = resource_manager_->GetTexture(sprite.GetTextureId());
-  if (texture == nullptr) {
+                            const glm::vec2& scroll_factor, const glm::bvec2& repeat, const glm::vec2& scale) {
+  FlushSprites();
+  const auto region = ResolveTextureRegion(sprite);
+  if (region.texture == nullptr) {
     LOGE(TAG, "Failed to get texture for {}!", sprite.GetTextureId());
     return;
   }
 
-  const auto src_rect = GetSpriteSrcRect(sprite);
+  const auto src_rect = GetSpriteSrcRect(sprite, region);
   if (!src_rect.has_value()) {
     LOGE(TAG, "Failed to get source rect for {}!", sprite.GetTextureId());
     return;
@@ -85,24 +113,44 @@ void Renderer::DrawParallax(const Camera& camera, const Sprite& sprite, const gl
     stop.y = glm::min(position_screen.y + scaled_tex_h, viewport_size.y);
   }
 
+  if (stop.x <= start.x || stop.y <= start.y) {
+    FlushSprites();
+    return;
+  }
+
+#if SUNNYLAND_HAS_TEXTURE_WRAP
+  // 纹理独占整张 SDL_Texture（不在图集页里）时，整层画成一个重复寻址的四边形，顶点数与平铺次数无关
+  float texture_w = 0.0f;
+  float texture_h = 0.0f;
+  if (is_texture_wrap_supported_ && SDL_GetTextureSize(region.texture, &texture_w, &texture_h) &&
+      src_rect->x == 0.0f && src_rect->y == 0.0f && src_rect->w == texture_w && src_rect->h == texture_h) {
+    // 不平铺的方向只画一块（可能被视口截短），与下面逐块平铺的结果一致
+    const float dst_w = repeat.x ? stop.x - start.x : scaled_tex_w;
+    const float dst_h = repeat.y ? stop.y - start.y : scaled_tex_h;
+    GetRecordingQueue().PushWrappedQuad(region.texture, {start.x, start.y, dst_w, dst_h},
+                                        {0.0f, 0.0f, dst_w / scaled_tex_w, dst_h / scaled_tex_h}, repeat.x, repeat.y);
+    return;
+  }
+#endif
+
+  // 图集中的纹理只能逐块平铺。平铺块单独占一个排序范围：同纹理同层，提交时合并成一次绘制
+  auto& queue = GetRecordingQueue();
   for (float y = start.y; y < stop.y; y += scaled_tex_h) {
     for (float x = start.x; x < stop.x; x += scaled_tex_w) {
-      SDL_FRect dest_rect = {x, y, scaled_tex_w, scaled_tex_h};
-      if (!SDL_RenderTexture(renderer_, texture, nullptr, &dest_rect)) {
-        LOGE(TAG, "Failed to render texture for {}!", sprite.GetTextureId());
-        return;
-      }
+      queue.Push({region.texture, region.rect, {x, y, scaled_tex_w, scaled_tex_h}, 0.0f, 0, false});
     }
   }
+  FlushSprites();
 }
 void Renderer::DrawUISprite(const Sprite& sprite, const glm::vec2& position,
-                            const std::optional<glm::vec2>& size) const {
-  const auto texture = resource_manager_->GetTexture(sprite.GetTextureId());
-  if (texture == nullptr) {
+                            const std::optional<glm::vec2>& size) {
+  FlushSprites();
+  const auto region = ResolveTextureRegion(sprite);
+  if (region.texture == nullptr) {
     LOGE(TAG, "Failed to get texture for {}!", sprite.GetTextureId());
     return;
   }
-  const auto src_rect = GetSpriteSrcRect(sprite);
+  const auto src_rect = GetSpriteSrcRect(sprite, region);
   if (!src_rect.has_value()) {
     LOGE(TAG, "Failed to get source rect for {}!", sprite.GetTextureId());
     return;
@@ -117,14 +165,30 @@ void Renderer::DrawUISprite(const Sprite& sprite, const glm::vec2& position,
     dest_rect.h = src_rect.value().h;
   }
 
-  if (!SDL_RenderTextureRotated(renderer_, texture, &src_rect.value(), &dest_rect, 0.0, nullptr,
-                                sprite.IsFlipped() ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE)) {
-    LOGE(TAG, "Failed to render texture for {}!", sprite.GetTextureId());
-  }
+  GetRecordingQueue().Push({region.texture, src_rect.value(), dest_rect, 0.0f, 0, sprite.IsFlipped()});
+  FlushSprites();
+}
+void Renderer::DrawGeometry(SDL_Texture* texture, const std::vector<SDL_Vertex>& vertices,
+                            const std::vector<int>& indices) {
+  GetRecordingQueue().PushGeometry(texture, vertices, indices);
+}
+void Renderer::FlushSprites() {
+  GetRecordingQueue().CloseSortScope();
+}
+void Renderer::EndFrame() {
+  GetRecordingQueue().CloseSortScope();
+  recording_index_ ^= 1;
+  GetRecordingQueue().Clear();
 }
-void Renderer::Present() const {
+void Renderer::SubmitFrame() {
+  PROFILE_SCOPE("Renderer::SubmitFrame");
+  frame_queues_[recording_index_ ^ 1].Submit(renderer_);
   SDL_RenderPresent(renderer_);
 }
+void Renderer::Present() {
+  EndFrame();
+  SubmitFrame();
+}
 void Renderer::ClearScreen() const {
   if (!SDL_RenderClear(renderer_)) {
     LOGE(TAG, "SDL_RenderClear failed: {}!", SDL_GetError());
@@ -140,13 +204,19 @@ void Renderer::SetDrawColorFloat(float r, float g, float b, float a) const {
     LOGE(TAG, "Failed to set draw color: {}!", SDL_GetError());
   }
 }
-std::optional<SDL_FRect> Renderer::GetSpriteSrcRect(const Sprite& sprite) const {
-  const auto texture = resource_manager_->GetTexture(sprite.GetTextureId());
-  if (texture == nullptr) {
-    LOGE(TAG, "Failed to get texture for {}!", sprite.GetTextureId());
-    return std::nullopt;
+engine::resource::TextureRegion Renderer::ResolveTextureRegion(const Sprite& sprite) const {
+  // 优先走句柄的 O(1) 查找；没有句柄或句柄已过期时才退回按路径查找。
+  // 录制可能在工作线程上，按路径查找不会加载纹理，未命中时本帧跳过，由主线程排队加载
+  if (const auto handle = sprite.GetTextureHandle(); handle.IsValid()) {
+    if (const auto region = resource_manager_->GetTextureRegion(handle); region.texture != nullptr) {
+      return region;
+    }
   }
-
+  return resource_manager_->GetTextureRegion(sprite.GetTextureId());
+}
+std::optional<SDL_FRect> Renderer::GetSpriteSrcRect(const Sprite& sprite,
+                                                    const engine::resource::TextureRegion& region) const {
+  // 精灵的源矩形是相对原图的坐标，需要平移到纹理区域（可能位于图集页中）
   const auto src_rect = sprite.GetSourceRect();
   if (src_rect.has_value()) {
     if (src_rect.value().w <= 0 || src_rect.value().h <= 0) {
@@ -154,15 +224,14 @@ std::optional<SDL_FRect> Renderer::GetSpriteSrcRect(const Sprite& sprite) const
            src_rect.value().h);
       return std::nullopt;
     }
-    return src_rect;
-  } else {
-    SDL_FRect result = {0, 0, 0, 0};
-    if (!SDL_GetTextureSize(texture, &result.w, &result.h)) {
-      LOGE(TAG, "Failed to get texture for {}!", sprite.GetTextureId());
-      return std::nullopt;
-    }
-    return result;
+    return SDL_FRect{region.rect.x + src_rect.value().x, region.rect.y + src_rect.value().y, src_rect.value().w,
+                     src_rect.value().h};
+  }
+  if (region.rect.w <= 0 || region.rect.h <= 0) {
+    LOGE(TAG, "Invalid texture region for {}!", sprite.GetTextureId());
+    return std::nullopt;
   }
+  return region.rect;
 }
 bool Renderer::IsRectInViewport(const Camera& camera, const SDL_FRect& rect) const {
   glm::vec2 viewport_size = camera.GetViewportSize();
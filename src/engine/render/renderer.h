@@ -1,8 +1,11 @@
 // renderer.h
 #pragma once
+#include <array>
 #include <glm/glm.hpp>
 #include <optional>
 #include <string>
+#include <vector>
+#include "render_queue.h"
 #include "sprite.h"
 
 struct SDL_Renderer;
@@ -15,25 +18,52 @@ class ResourceManager;
 namespace engine::render {
 class Camera;
 
+/**
+ * @brief 渲染器。
+ * 所有 Draw* 只把命令录制进当前帧的 RenderQueue，不直接调用 SDL，所以可以在模拟线程上执行。
+ * 帧队列是双缓冲的：EndFrame 把录好的帧交给提交侧，SubmitFrame 在主线程回放并呈现。
+ * 流水线模式下，模拟线程录制第 N+1 帧的同时，主线程提交第 N 帧。
+ */
 class Renderer final {
  public:
   explicit Renderer(SDL_Renderer* sdl_renderer, engine::resource::ResourceManager* resource_manager);
 
+  // 精灵进入当前排序范围，同一范围内按 (layer, 纹理, depth) 排序、合批
   void DrawSprite(const Camera& camera, const Sprite& sprite, const glm::vec2& position,
-                  const glm::vec2& scale = {1.0f, 1.0f}, double angle = 0.0f) const;
+                  const glm::vec2& scale = {1.0f, 1.0f}, double angle = 0.0f, int32_t layer = 0,
+                  float depth = 0.0f);
+  // world_rect 为已算好的世界坐标目标矩形（位置 + 缩放后的尺寸），调用方可以缓存它，每帧只做相机变换和视口裁剪
+  void DrawSprite(const Camera& camera, const Sprite& sprite, const SDL_FRect& world_rect, float angle = 0.0f,
+                  int32_t layer = 0, float depth = 0.0f);
+  // 独立纹理在渲染器支持任意尺寸纹理重复寻址时整层只录一个四边形，否则（含图集中的纹理）逐块平铺
   void DrawParallax(const Camera& camera, const Sprite& sprite, const glm::vec2& position,
                     const glm::vec2& scroll_factor, const glm::bvec2& repeat = {true, true},
-                    const glm::vec2& scale = {1.0f, 1.0f}) const;
+                    const glm::vec2& scale = {1.0f, 1.0f});
 
   void DrawUISprite(const Sprite& sprite, const glm::vec2& position,
-                    const std::optional<glm::vec2>& size = std::nullopt) const;
+                    const std::optional<glm::vec2>& size = std::nullopt);
 
-  void Present() const;
+  // 录制一组屏幕坐标下的三角形（如瓦片分块），位于之前所有绘制的上方
+  void DrawGeometry(SDL_Texture* texture, const std::vector<SDL_Vertex>& vertices, const std::vector<int>& indices);
+
+  // 结束当前排序范围，保证之后的绘制位于其上方
+  void FlushSprites();
+  // 结束本帧录制：录好的帧成为待提交帧，之后的绘制录入另一个队列
+  void EndFrame();
+  // 回放待提交帧并呈现，只能在主线程调用
+  void SubmitFrame();
+  // 单线程模式下的 EndFrame + SubmitFrame
+  void Present();
   void ClearScreen() const;
 
   void SetDrawColor(Uint8 r, Uint8 g, Uint8 b, Uint8 a = 255) const;
   void SetDrawColorFloat(float r, float g, float b, float a = 1.0f) const;
 
+  // 最近一次 SubmitFrame 的统计
+  [[nodiscard]] const RenderStats& GetLastFrameStats() const {
+    return frame_queues_[recording_index_ ^ 1].GetStats();
+  }
+
   SDL_Renderer* GetSDLRenderer() const {
     return renderer_;
   }
@@ -45,12 +75,19 @@ class Renderer final {
   Renderer& operator=(Renderer&&) = delete;
 
  private:
-  std::optional<SDL_FRect> GetSpriteSrcRect(const Sprite& sprite) const;
+  [[nodiscard]] engine::resource::TextureRegion ResolveTextureRegion(const Sprite& sprite) const;
+  std::optional<SDL_FRect> GetSpriteSrcRect(const Sprite& sprite, const engine::resource::TextureRegion& region) const;
   [[nodiscard]] bool IsRectInViewport(const Camera& camera, const SDL_FRect& rect) const;
+  [[nodiscard]] RenderQueue& GetRecordingQueue() {
+    return frame_queues_[recording_index_];
+  }
 
  private:
   SDL_Renderer* renderer_ = nullptr;
   engine::resource::ResourceManager* resource_manager_ = nullptr;
+  std::array<RenderQueue, 2> frame_queues_;
+  size_t recording_index_ = 0;  // 另一个下标是待提交帧
+  bool is_texture_wrap_supported_ = false;  // 构造时查询一次 SDL_PROP_RENDERER_TEXTURE_WRAPPING_BOOLEAN
 };
 
 }  // namespace engine::render
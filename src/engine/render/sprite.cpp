@@ -9,6 +9,9 @@ Sprite::~Sprite() {
 const std::string& Sprite::GetTextureId() const {
   return texture_id_;
 }
+engine::resource::TextureHandle Sprite::GetTextureHandle() const {
+  return texture_handle_;
+}
 const std::optional<SDL_FRect>& Sprite::GetSourceRect() const {
   return source_rect_;
 }
@@ -17,6 +20,10 @@ bool Sprite::IsFlipped() const {
 }
 void Sprite::SetTextureId(const std::string& texture_id) {
   texture_id_ = texture_id;
+  texture_handle_ = {};
+}
+void Sprite::SetTextureHandle(engine::resource::TextureHandle handle) {
+  texture_handle_ = handle;
 }
 void Sprite::SetSourceRect(const std::optional<SDL_FRect>& source_rect) {
   source_rect_ = source_rect;
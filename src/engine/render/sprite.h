@@ -3,6 +3,7 @@
 #include <SDL3/SDL_rect.h>
 #include <optional>
 #include <string>
+#include "resource/texture_handle.h"
 
 namespace engine::render {
 class Sprite final {
@@ -12,15 +13,19 @@ class Sprite final {
   ~Sprite();
 
   const std::string& GetTextureId() const;
+  engine::resource::TextureHandle GetTextureHandle() const;
   const std::optional<SDL_FRect>& GetSourceRect() const;
   bool IsFlipped() const;
 
+  // 更换纹理路径会使已缓存的句柄失效，需要重新 SetTextureHandle
   void SetTextureId(const std::string& texture_id);
+  void SetTextureHandle(engine::resource::TextureHandle handle);
   void SetSourceRect(const std::optional<SDL_FRect>& source_rect);
   void SetFlipped(bool flipped);
 
  private:
   std::string texture_id_;
+  engine::resource::TextureHandle texture_handle_;
   std::optional<SDL_FRect> source_rect_;
   bool is_flipped_ = true;
 };
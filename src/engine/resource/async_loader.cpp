@@ -0,0 +1,288 @@
+#include "async_loader.h"
+#include "audio_manager.h"
+#include "logger.hpp"
+#include "texture_manager.h"
+#include "utils/profiler.h"
+
+#include <SDL3/SDL_surface.h>
+#include <SDL3/SDL_timer.h>
+#include <SDL3_image/SDL_image.h>
+#include <SDL3_mixer/SDL_mixer.h>
+#include <algorithm>
+
+namespace engine::resource {
+namespace {
+DECLARE_TAG(AsyncLoader);
+// 默认最多两个解码线程，给主线程和音频线程留出核心
+constexpr size_t kMaxDefaultWorkers = 2;
+}  // namespace
+
+AsyncLoader::AsyncLoader(TextureManager& texture_manager, AudioManager& audio_manager, size_t worker_count)
+    : texture_manager_(texture_manager), audio_manager_(audio_manager) {
+  if (worker_count == 0) {
+    const size_t hardware = std::thread::hardware_concurrency();
+    worker_count = std::clamp<size_t>(hardware > 1 ? hardware - 1 : 1, 1, kMaxDefaultWorkers);
+  }
+  workers_.reserve(worker_count);
+  for (size_t i = 0; i < worker_count; ++i) {
+    workers_.emplace_back(&AsyncLoader::WorkerLoop, this);
+  }
+  LOGI(TAG, "AsyncLoader started with {} worker(s)", worker_count);
+}
+
+AsyncLoader::~AsyncLoader() {
+  {
+    std::lock_guard lock(job_mutex_);
+    is_stopping_ = true;
+    jobs_.clear();
+  }
+  job_cv_.notify_all();
+  for (auto& worker : workers_) {
+    if (worker.joinable()) {
+      worker.join();
+    }
+  }
+  // 已解码但还没上传的结果直接释放
+  for (auto& result : results_) {
+    FreeResult(result);
+  }
+  results_.clear();
+  TRACEI(TAG);
+}
+
+uint32_t AsyncLoader::Preload(const PreloadSet& preload_set, PreloadProgressCallback on_progress,
+                              PreloadCompleteCallback on_complete) {
+  const uint32_t request_id = CreateRequest(std::move(on_progress), std::move(on_complete));
+  EnqueueAssets(request_id, preload_set);
+  return request_id;
+}
+
+uint32_t AsyncLoader::Preload(PreloadCollector collector, PreloadProgressCallback on_progress,
+                              PreloadCompleteCallback on_complete) {
+  const uint32_t request_id = CreateRequest(std::move(on_progress), std::move(on_complete));
+  requests_[request_id].is_collecting = true;
+  std::vector<Job> new_jobs;
+  new_jobs.push_back({request_id, AssetType::COLLECT, {}, std::move(collector)});
+  SubmitJobs(std::move(new_jobs));
+  LOGD(TAG, "Preload request {}: collecting asset list", request_id);
+  return request_id;
+}
+
+uint32_t AsyncLoader::CreateRequest(PreloadProgressCallback on_progress, PreloadCompleteCallback on_complete) {
+  const uint32_t request_id = next_request_id_++;
+  auto& request = requests_[request_id];
+  request.on_progress = std::move(on_progress);
+  request.on_complete = std::move(on_complete);
+  return request_id;
+}
+
+void AsyncLoader::EnqueueAssets(uint32_t request_id, const PreloadSet& preload_set) {
+  auto& request = requests_[request_id];
+  request.total += preload_set.Size();
+
+  std::vector<Job> new_jobs;
+  new_jobs.reserve(preload_set.Size());
+  const auto enqueue = [&](const std::vector<std::string>& paths, AssetType type, auto&& is_loaded) {
+    for (const auto& path : paths) {
+      if (is_loaded(path)) {
+        ++request.loaded;
+      } else {
+        new_jobs.push_back({request_id, type, path, nullptr});
+      }
+    }
+  };
+  enqueue(preload_set.textures, AssetType::TEXTURE,
+          [this](const std::string& path) { return texture_manager_.HasTexture(path); });
+  enqueue(preload_set.sounds, AssetType::SOUND,
+          [this](const std::string& path) { return audio_manager_.HasSound(path); });
+  enqueue(preload_set.music, AssetType::MUSIC,
+          [this](const std::string& path) { return audio_manager_.HasMusic(path); });
+
+  SubmitJobs(std::move(new_jobs));
+  LOGD(TAG, "Preload request {}: {} asset(s), {} already loaded", request_id, request.total, request.loaded);
+}
+
+void AsyncLoader::SubmitJobs(std::vector<Job>&& new_jobs) {
+  if (new_jobs.empty()) {
+    return;
+  }
+  {
+    std::lock_guard lock(result_mutex_);
+    in_flight_ += new_jobs.size();
+  }
+  {
+    std::lock_guard lock(job_mutex_);
+    for (auto& job : new_jobs) {
+      jobs_.push_back(std::move(job));
+    }
+  }
+  job_cv_.notify_all();
+}
+
+void AsyncLoader::Update(uint64_t budget_ns) {
+  PROFILE_SCOPE("AsyncLoader::Update");
+  const uint64_t start = SDL_GetTicksNS();
+  while (true) {
+    Result result;
+    {
+      std::lock_guard lock(result_mutex_);
+      if (results_.empty()) {
+        break;
+      }
+      result = std::move(results_.front());
+      results_.pop_front();
+    }
+    // 先上传（清单结果会在这里提交后续任务）再减计数，IsIdle 不会在两者之间误报空闲
+    Upload(result);
+    {
+      std::lock_guard lock(result_mutex_);
+      --in_flight_;
+    }
+
+    if (const auto it = requests_.find(result.request_id); it != requests_.end()) {
+      auto& request = it->second;
+      if (result.type != AssetType::COLLECT) {
+        ++request.loaded;
+      }
+      if (request.on_progress) {
+        request.on_progress(request.loaded, request.total);
+      }
+    }
+    if (SDL_GetTicksNS() - start >= budget_ns) {
+      break;
+    }
+  }
+  NotifyCompletedRequests();
+}
+
+bool AsyncLoader::IsIdle() const {
+  std::lock_guard lock(result_mutex_);
+  return in_flight_ == 0;
+}
+
+void AsyncLoader::WorkerLoop() {
+  engine::utils::Profiler::SetThreadName("AsyncLoader");
+  while (true) {
+    Job job;
+    {
+      std::unique_lock lock(job_mutex_);
+      job_cv_.wait(lock, [this] { return is_stopping_ || !jobs_.empty(); });
+      if (is_stopping_) {
+        return;
+      }
+      job = std::move(jobs_.front());
+      jobs_.pop_front();
+    }
+
+    Result result = Decode(job);
+    std::lock_guard lock(result_mutex_);
+    results_.push_back(std::move(result));
+  }
+}
+
+AsyncLoader::Result AsyncLoader::Decode(const Job& job) {
+  PROFILE_SCOPE("AsyncLoader::Decode");
+  Result result{job.request_id, job.type, job.path};
+  switch (job.type) {
+  case AssetType::TEXTURE: {
+    SDL_Surface* surface = IMG_Load(job.path.c_str());
+    if (surface == nullptr) {
+      LOGE(TAG, "Failed to decode image: {}, error: {}", job.path, SDL_GetError());
+      break;
+    }
+    // 顺便在工作线程转成图集使用的像素格式，主线程上传时不必再转换
+    if (surface->format != SDL_PIXELFORMAT_RGBA32) {
+      SDL_Surface* converted = SDL_ConvertSurface(surface, SDL_PIXELFORMAT_RGBA32);
+      if (converted != nullptr) {
+        SDL_DestroySurface(surface);
+        surface = converted;
+      }
+    }
+    result.surface = surface;
+    break;
+  }
+  case AssetType::SOUND:
+    result.chunk = Mix_LoadWAV(job.path.c_str());
+    if (result.chunk == nullptr) {
+      LOGE(TAG, "Failed to decode sound: {}, error: {}", job.path, SDL_GetError());
+    }
+    break;
+  case AssetType::MUSIC:
+    result.music = Mix_LoadMUS(job.path.c_str());
+    if (result.music == nullptr) {
+      LOGE(TAG, "Failed to open music: {}, error: {}", job.path, SDL_GetError());
+    }
+    break;
+  case AssetType::COLLECT:
+    // 清单生成失败时按空清单处理，请求照常完成，缺的资源之后按需加载
+    try {
+      result.collected = job.collector();
+    } catch (const std::exception& e) {
+      LOGE(TAG, "Failed to collect preload assets, error: {}", e.what());
+    }
+    break;
+  }
+  return result;
+}
+
+void AsyncLoader::FreeResult(Result& result) {
+  if (result.surface != nullptr) {
+    SDL_DestroySurface(result.surface);
+    result.surface = nullptr;
+  }
+  if (result.chunk != nullptr) {
+    Mix_FreeChunk(result.chunk);
+    result.chunk = nullptr;
+  }
+  if (result.music != nullptr) {
+    Mix_FreeMusic(result.music);
+    result.music = nullptr;
+  }
+}
+
+void AsyncLoader::Upload(Result& result) {
+  switch (result.type) {
+  case AssetType::TEXTURE:
+    if (result.surface != nullptr) {
+      texture_manager_.AddTexture(result.path, result.surface);
+    }
+    break;
+  case AssetType::SOUND:
+    // AudioManager 接管 chunk 的所有权
+    audio_manager_.AddSound(result.path, result.chunk);
+    result.chunk = nullptr;
+    break;
+  case AssetType::MUSIC:
+    audio_manager_.AddMusic(result.path, result.music);
+    result.music = nullptr;
+    break;
+  case AssetType::COLLECT:
+    if (const auto it = requests_.find(result.request_id); it != requests_.end()) {
+      it->second.is_collecting = false;
+      EnqueueAssets(result.request_id, result.collected);
+    }
+    break;
+  }
+  FreeResult(result);
+}
+
+void AsyncLoader::NotifyCompletedRequests() {
+  // 先收集再回调：回调里可能再次调用 Preload 修改 requests_
+  std::vector<PreloadCompleteCallback> completed;
+  for (auto it = requests_.begin(); it != requests_.end();) {
+    if (!it->second.is_collecting && it->second.loaded >= it->second.total) {
+      LOGD(TAG, "Preload request {} completed", it->first);
+      if (it->second.on_complete) {
+        completed.push_back(std::move(it->second.on_complete));
+      }
+      it = requests_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  for (const auto& callback : completed) {
+    callback();
+  }
+}
+
+}  // namespace engine::resource
@@ -0,0 +1,124 @@
+#pragma once
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+struct SDL_Surface;
+struct Mix_Chunk;
+struct Mix_Music;
+
+namespace engine::resource {
+class TextureManager;
+class AudioManager;
+
+// 一组需要预加载的资源路径
+struct PreloadSet {
+  std::vector<std::string> textures;
+  std::vector<std::string> sounds;
+  std::vector<std::string> music;
+
+  [[nodiscard]] size_t Size() const {
+    return textures.size() + sounds.size() + music.size();
+  }
+  [[nodiscard]] bool IsEmpty() const {
+    return Size() == 0;
+  }
+};
+
+// 回调都在主线程（AsyncLoader::Update 内）调用
+using PreloadProgressCallback = std::function<void(size_t loaded, size_t total)>;
+using PreloadCompleteCallback = std::function<void()>;
+// 在加载线程上生成资源清单（例如解析关卡文件），不能访问场景对象、渲染器等主线程数据
+using PreloadCollector = std::function<PreloadSet()>;
+
+/**
+ * @brief 异步资源加载器。
+ * 工作线程负责读文件和解码（图片解码为 RGBA32 surface，音频解码为 Mix_Chunk/Mix_Music），
+ * 主线程在 Update 中按时间预算把解码结果交给 TextureManager/AudioManager，只做 GPU 上传这类轻量工作。
+ * 渲染器不是线程安全的，所以创建纹理必须留在主线程。
+ */
+class AsyncLoader final {
+ public:
+  explicit AsyncLoader(TextureManager& texture_manager, AudioManager& audio_manager, size_t worker_count = 0);
+  ~AsyncLoader();
+
+  // 禁止拷贝和移动
+  AsyncLoader(const AsyncLoader&) = delete;
+  AsyncLoader& operator=(const AsyncLoader&) = delete;
+  AsyncLoader(AsyncLoader&&) = delete;
+  AsyncLoader& operator=(AsyncLoader&&) = delete;
+
+  // 提交一组预加载请求，返回请求 id。已加载的资源直接计为完成，完成回调在之后的 Update 中触发
+  uint32_t Preload(const PreloadSet& preload_set, PreloadProgressCallback on_progress = nullptr,
+                   PreloadCompleteCallback on_complete = nullptr);
+  // 先在工作线程上运行 collector 得到资源清单，再按上面的方式加载。清单就绪时报告一次进度
+  uint32_t Preload(PreloadCollector collector, PreloadProgressCallback on_progress = nullptr,
+                   PreloadCompleteCallback on_complete = nullptr);
+  // 每帧在主线程调用：上传解码结果直到用完预算（纳秒），至少处理一项以保证进度
+  void Update(uint64_t budget_ns);
+
+  [[nodiscard]] bool IsIdle() const;
+
+ private:
+  enum class AssetType { TEXTURE, SOUND, MUSIC, COLLECT };
+
+  struct Job {
+    uint32_t request_id = 0;
+    AssetType type = AssetType::TEXTURE;
+    std::string path;
+    PreloadCollector collector;  // 只有 COLLECT 使用
+  };
+  // 解码结果，指针为空表示解码失败
+  struct Result {
+    uint32_t request_id = 0;
+    AssetType type = AssetType::TEXTURE;
+    std::string path;
+    SDL_Surface* surface = nullptr;
+    Mix_Chunk* chunk = nullptr;
+    Mix_Music* music = nullptr;
+    PreloadSet collected{};  // COLLECT 的结果
+  };
+  struct Request {
+    size_t total = 0;
+    size_t loaded = 0;
+    PreloadProgressCallback on_progress;
+    PreloadCompleteCallback on_complete;
+    bool is_collecting = false;  // 清单还在生成，total 尚未确定
+  };
+
+  uint32_t CreateRequest(PreloadProgressCallback on_progress, PreloadCompleteCallback on_complete);
+  // 已加载的资源直接计为完成，其余提交给工作线程
+  void EnqueueAssets(uint32_t request_id, const PreloadSet& preload_set);
+  void SubmitJobs(std::vector<Job>&& new_jobs);
+  void WorkerLoop();
+  static Result Decode(const Job& job);
+  static void FreeResult(Result& result);
+  void Upload(Result& result);
+  void NotifyCompletedRequests();
+
+  TextureManager& texture_manager_;
+  AudioManager& audio_manager_;
+
+  std::mutex job_mutex_;
+  std::condition_variable job_cv_;
+  std::deque<Job> jobs_;
+  bool is_stopping_ = false;
+
+  mutable std::mutex result_mutex_;
+  std::deque<Result> results_;
+  size_t in_flight_ = 0;  // 已提交但尚未上传的任务数，受 result_mutex_ 保护
+
+  // 以下只在主线程访问
+  std::unordered_map<uint32_t, Request> requests_;
+  uint32_t next_request_id_ = 1;
+
+  std::vector<std::thread> workers_;
+};
+
+}  // namespace engine::resource
@@ -1,5 +1,6 @@
 #include "audio_manager.h"
 #include "logger.hpp"
+#include "utils/profiler.h"
 
 namespace engine::resource {
 namespace {
@@ -35,6 +36,7 @@ Mix_Chunk* AudioManager::LoadSound(const std::string& file_path) {
   if (sounds_.contains(file_path)) {
     return sounds_.at(file_path).get();
   }
+  PROFILE_SCOPE("AudioManager::LoadSound");
 
   Mix_Chunk* raw_chunk = Mix_LoadWAV(file_path.c_str());
   if (raw_chunk == nullptr) {
@@ -45,6 +47,23 @@ Mix_Chunk* AudioManager::LoadSound(const std::string& file_path) {
   LOGI(TAG, "Loaded sound: {}", file_path);
   return raw_chunk;
 }
+Mix_Chunk* AudioManager::AddSound(const std::string& file_path, Mix_Chunk* chunk) {
+  if (const auto it = sounds_.find(file_path); it != sounds_.end()) {
+    if (chunk != nullptr && chunk != it->second.get()) {
+      Mix_FreeChunk(chunk);
+    }
+    return it->second.get();
+  }
+  if (chunk == nullptr) {
+    return nullptr;
+  }
+  sounds_.emplace(file_path, std::unique_ptr<Mix_Chunk, SDLMixChunkDeleter>(chunk));
+  LOGI(TAG, "Loaded sound: {}", file_path);
+  return chunk;
+}
+bool AudioManager::HasSound(const std::string& file_path) const {
+  return sounds_.contains(file_path);
+}
 Mix_Chunk* AudioManager::GetSound(const std::string& file_path) {
   if (sounds_.contains(file_path)) {
     return sounds_.at(file_path).get();
@@ -70,6 +89,7 @@ Mix_Music* AudioManager::LoadMusic(const std::string& file_path) {
   if (musics_.contains(file_path)) {
     return musics_.at(file_path).get();
   }
+  PROFILE_SCOPE("AudioManager::LoadMusic");
 
   Mix_Music* raw_music = Mix_LoadMUS(file_path.c_str());
   if (raw_music == nullptr) {
@@ -80,6 +100,23 @@ Mix_Music* AudioManager::LoadMusic(const std::string& file_path) {
   LOGI(TAG, "Loaded music: {}", file_path);
   return raw_music;
 }
+Mix_Music* AudioManager::AddMusic(const std::string& file_path, Mix_Music* music) {
+  if (const auto it = musics_.find(file_path); it != musics_.end()) {
+    if (music != nullptr && music != it->second.get()) {
+      Mix_FreeMusic(music);
+    }
+    return it->second.get();
+  }
+  if (music == nullptr) {
+    return nullptr;
+  }
+  musics_.emplace(file_path, std::unique_ptr<Mix_Music, SDLMixMusicDeleter>(music));
+  LOGI(TAG, "Loaded music: {}", file_path);
+  return music;
+}
+bool AudioManager::HasMusic(const std::string& file_path) const {
+  return musics_.contains(file_path);
+}
 Mix_Music* AudioManager::GetMusic(const std::string& file_path) {
   if (musics_.contains(file_path)) {
     return musics_.at(file_path).get();
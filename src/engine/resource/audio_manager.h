@@ -20,11 +20,16 @@ class AudioManager final {
 
  public:
   Mix_Chunk* LoadSound(const std::string& file_path);
+  // 接管已解码音效的所有权（异步加载完成后调用），路径已存在时释放传入的 chunk
+  Mix_Chunk* AddSound(const std::string& file_path, Mix_Chunk* chunk);
+  [[nodiscard]] bool HasSound(const std::string& file_path) const;
   Mix_Chunk* GetSound(const std::string& file_path);
   void UnloadSound(const std::string& file_path);
   void ClearSounds();
 
   Mix_Music* LoadMusic(const std::string& file_path);
+  Mix_Music* AddMusic(const std::string& file_path, Mix_Music* music);
+  [[nodiscard]] bool HasMusic(const std::string& file_path) const;
   Mix_Music* GetMusic(const std::string& file_path);
   void UnloadMusic(const std::string& file_path);
   void ClearMusic();
@@ -11,7 +11,8 @@ DECLARE_TAG(ResourceManager)
 
 ResourceManager::ResourceManager(SDL_Renderer* renderer)
     : texture_manager_(std::make_unique<TextureManager>(renderer)), audio_manager_(std::make_unique<AudioManager>()),
-      font_manager_(std::make_unique<FontManager>()) {
+      font_manager_(std::make_unique<FontManager>()),
+      async_loader_(std::make_unique<AsyncLoader>(*texture_manager_, *audio_manager_)) {
   TRACEI(TAG);
 }
 ResourceManager::~ResourceManager() {
@@ -22,15 +23,30 @@ void ResourceManager::Clear() {
   audio_manager_->ClearAudio();
   texture_manager_->ClearTextures();
 }
-SDL_Texture* ResourceManager::LoadTexture(const std::string& name) const {
+TextureHandle ResourceManager::LoadTexture(const std::string& name) const {
   return texture_manager_->LoadTexture(name);
 }
+TextureHandle ResourceManager::FindTexture(const std::string& name) const {
+  return texture_manager_->FindTexture(name);
+}
+SDL_Texture* ResourceManager::GetTexture(TextureHandle handle) const {
+  return texture_manager_->GetTexture(handle);
+}
 SDL_Texture* ResourceManager::GetTexture(const std::string& name) const {
   return texture_manager_->GetTexture(name);
 }
+TextureRegion ResourceManager::GetTextureRegion(TextureHandle handle) const {
+  return texture_manager_->GetTextureRegion(handle);
+}
+TextureRegion ResourceManager::GetTextureRegion(const std::string& name) const {
+  return texture_manager_->GetTextureRegion(name);
+}
 void ResourceManager::UnloadTexture(const std::string& name) {
   texture_manager_->UnloadTexture(name);
 }
+glm::vec2 ResourceManager::GetTextureSize(TextureHandle handle) const {
+  return texture_manager_->GetTextureSize(handle);
+}
 glm::vec2 ResourceManager::GetTextureSize(const std::string& name) const {
   return texture_manager_->GetTextureSize(name);
 }
@@ -73,4 +89,19 @@ void ResourceManager::UnloadFont(const std::string& name, int32_t point_size) {
 void ResourceManager::ClearFonts() const {
   font_manager_->ClearFonts();
 }
+uint32_t ResourceManager::PreloadAsync(const PreloadSet& preload_set, PreloadProgressCallback on_progress,
+                                      PreloadCompleteCallback on_complete) const {
+  return async_loader_->Preload(preload_set, std::move(on_progress), std::move(on_complete));
+}
+uint32_t ResourceManager::PreloadAsync(PreloadCollector collector, PreloadProgressCallback on_progress,
+                                      PreloadCompleteCallback on_complete) const {
+  return async_loader_->Preload(std::move(collector), std::move(on_progress), std::move(on_complete));
+}
+void ResourceManager::Update(uint64_t budget_ns) const {
+  texture_manager_->ProcessPendingRequests();
+  async_loader_->Update(budget_ns);
+}
+bool ResourceManager::IsLoadingIdle() const {
+  return async_loader_->IsIdle();
+}
 }  // namespace engine::resource
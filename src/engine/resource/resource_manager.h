@@ -3,6 +3,8 @@
 #include <glm/glm.hpp>
 #include <memory>
 #include <string>
+#include "async_loader.h"
+#include "texture_handle.h"
 
 struct SDL_Renderer;
 struct SDL_Texture;
@@ -26,9 +28,15 @@ class ResourceManager final {
   ResourceManager(ResourceManager&& other) = delete;
   ResourceManager& operator=(ResourceManager&& other) = delete;
 
-  SDL_Texture* LoadTexture(const std::string& name) const;
+  TextureHandle LoadTexture(const std::string& name) const;
+  // 只查找不加载，可在渲染录制线程上调用；未命中时登记加载，由下一次 Update 在主线程完成
+  TextureHandle FindTexture(const std::string& name) const;
+  SDL_Texture* GetTexture(TextureHandle handle) const;
   SDL_Texture* GetTexture(const std::string& name) const;
+  TextureRegion GetTextureRegion(TextureHandle handle) const;
+  TextureRegion GetTextureRegion(const std::string& name) const;
   void UnloadTexture(const std::string& name);
+  glm::vec2 GetTextureSize(TextureHandle handle) const;
   glm::vec2 GetTextureSize(const std::string& name) const;
   void ClearTextures() const;
 
@@ -47,9 +55,21 @@ class ResourceManager final {
   void UnloadFont(const std::string& name, int32_t point_size);
   void ClearFonts() const;
 
+  // 异步预加载：工作线程解码，Update 中按预算上传，回调在主线程触发
+  uint32_t PreloadAsync(const PreloadSet& preload_set, PreloadProgressCallback on_progress = nullptr,
+                        PreloadCompleteCallback on_complete = nullptr) const;
+  // 资源清单本身也在工作线程上生成（例如需要解析关卡文件时）
+  uint32_t PreloadAsync(PreloadCollector collector, PreloadProgressCallback on_progress = nullptr,
+                        PreloadCompleteCallback on_complete = nullptr) const;
+  // 每帧在主线程的帧同步点调用一次：处理排队的纹理加载/卸载，budget_ns 为本帧允许用于上传的时间
+  void Update(uint64_t budget_ns) const;
+  [[nodiscard]] bool IsLoadingIdle() const;
+
  private:
   std::unique_ptr<TextureManager> texture_manager_{nullptr};
   std::unique_ptr<AudioManager> audio_manager_{nullptr};
   std::unique_ptr<FontManager> font_manager_{nullptr};
+  // 依赖上面的管理器，声明在最后以保证最先析构（先停止工作线程）
+  std::unique_ptr<AsyncLoader> async_loader_{nullptr};
 };
 }  // namespace engine::resource
@@ -0,0 +1,153 @@
+#include "texture_atlas.h"
+#include "logger.hpp"
+
+#include <limits>
+
+namespace engine::resource {
+namespace {
+DECLARE_TAG(TextureAtlas);
+
+struct SDLSurfaceDeleter {
+  void operator()(SDL_Surface* surface) const {
+    if (surface) {
+      SDL_DestroySurface(surface);
+    }
+  }
+};
+}  // namespace
+
+TextureAtlas::TextureAtlas(SDL_Renderer* renderer) : renderer_(renderer) {
+  if (renderer_ == nullptr) {
+    throw std::invalid_argument("SDL_Renderer is null");
+  }
+}
+TextureAtlas::~TextureAtlas() = default;
+
+bool TextureAtlas::Accepts(const SDL_Surface* surface) {
+  return surface && surface->w > 0 && surface->h > 0 && surface->w <= kMaxRegionSize &&
+         surface->h <= kMaxRegionSize;
+}
+
+std::optional<TextureRegion> TextureAtlas::Insert(SDL_Surface* surface) {
+  if (!Accepts(surface)) {
+    return std::nullopt;
+  }
+  const int padded_w = surface->w + 2 * kPadding;
+  const int padded_h = surface->h + 2 * kPadding;
+
+  Page* target_page = nullptr;
+  std::optional<SDL_Point> position;
+  for (auto& page : pages_) {
+    if (position = Allocate(page, padded_w, padded_h); position.has_value()) {
+      target_page = &page;
+      break;
+    }
+  }
+  if (!position.has_value()) {
+    target_page = CreatePage();
+    if (target_page == nullptr) {
+      return std::nullopt;
+    }
+    position = Allocate(*target_page, padded_w, padded_h);
+    if (!position.has_value()) {
+      return std::nullopt;
+    }
+  }
+
+  if (!Upload(target_page->texture.get(), surface, position.value())) {
+    return std::nullopt;
+  }
+  return TextureRegion{target_page->texture.get(),
+                       {static_cast<float>(position->x + kPadding), static_cast<float>(position->y + kPadding),
+                        static_cast<float>(surface->w), static_cast<float>(surface->h)}};
+}
+
+void TextureAtlas::Clear() {
+  pages_.clear();
+  LOGI(TAG, "Cleared all atlas pages");
+}
+
+std::optional<SDL_Point> TextureAtlas::Allocate(Page& page, int width, int height) {
+  // 选择高度最贴合的现有行，浪费最少
+  Shelf* best_shelf = nullptr;
+  int best_waste = std::numeric_limits<int>::max();
+  for (auto& shelf : page.shelves) {
+    if (shelf.height < height || shelf.cursor_x + width > kPageSize) {
+      continue;
+    }
+    if (const int waste = shelf.height - height; waste < best_waste) {
+      best_waste = waste;
+      best_shelf = &shelf;
+    }
+  }
+
+  if (best_shelf == nullptr) {
+    if (page.next_shelf_y + height > kPageSize) {
+      return std::nullopt;
+    }
+    best_shelf = &page.shelves.emplace_back(Shelf{page.next_shelf_y, height, 0});
+    page.next_shelf_y += height;
+  }
+
+  const SDL_Point position = {best_shelf->cursor_x, best_shelf->y};
+  best_shelf->cursor_x += width;
+  return position;
+}
+
+TextureAtlas::Page* TextureAtlas::CreatePage() {
+  SDL_Texture* texture =
+      SDL_CreateTexture(renderer_, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, kPageSize, kPageSize);
+  if (texture == nullptr) {
+    LOGE(TAG, "Failed to create atlas page: {}", SDL_GetError());
+    return nullptr;
+  }
+  SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+
+  auto& page = pages_.emplace_back();
+  page.texture.reset(texture);
+  LOGI(TAG, "Created atlas page #{} ({}x{})", pages_.size() - 1, kPageSize, kPageSize);
+  return &page;
+}
+
+bool TextureAtlas::Upload(SDL_Texture* page_texture, SDL_Surface* surface, const SDL_Point& position) const {
+  const int w = surface->w;
+  const int h = surface->h;
+  constexpr int p = kPadding;
+  std::unique_ptr<SDL_Surface, SDLSurfaceDeleter> padded(SDL_CreateSurface(w + 2 * p, h + 2 * p, SDL_PIXELFORMAT_RGBA32));
+  if (!padded) {
+    LOGE(TAG, "Failed to create padded surface: {}", SDL_GetError());
+    return false;
+  }
+
+  // 直接拷贝像素而不做混合，然后把最外一圈像素向外复制一像素
+  SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_NONE);
+  const struct {
+    SDL_Rect src;
+    SDL_Rect dst;
+  } blits[] = {
+      {{0, 0, w, h}, {p, p, w, h}},                  // 图片本体
+      {{0, 0, w, 1}, {p, 0, w, 1}},                  // 上边
+      {{0, h - 1, w, 1}, {p, h + p, w, 1}},          // 下边
+      {{0, 0, 1, h}, {0, p, 1, h}},                  // 左边
+      {{w - 1, 0, 1, h}, {w + p, p, 1, h}},          // 右边
+      {{0, 0, 1, 1}, {0, 0, 1, 1}},                  // 左上角
+      {{w - 1, 0, 1, 1}, {w + p, 0, 1, 1}},          // 右上角
+      {{0, h - 1, 1, 1}, {0, h + p, 1, 1}},          // 左下角
+      {{w - 1, h - 1, 1, 1}, {w + p, h + p, 1, 1}},  // 右下角
+  };
+  for (const auto& blit : blits) {
+    if (!SDL_BlitSurface(surface, &blit.src, padded.get(), &blit.dst)) {
+      LOGE(TAG, "Failed to blit into padded surface: {}", SDL_GetError());
+      return false;
+    }
+  }
+
+  const SDL_Rect dst_rect = {position.x, position.y, padded->w, padded->h};
+  if (!SDL_UpdateTexture(page_texture, &dst_rect, padded->pixels, padded->pitch)) {
+    LOGE(TAG, "Failed to upload region into atlas page: {}", SDL_GetError());
+    return false;
+  }
+  return true;
+}
+
+}  // namespace engine::resource
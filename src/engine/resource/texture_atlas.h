@@ -0,0 +1,69 @@
+#pragma once
+#include <SDL3/SDL_render.h>
+#include <memory>
+#include <optional>
+#include <vector>
+#include "texture_handle.h"
+
+namespace engine::resource {
+
+/**
+ * @brief 运行时纹理图集。
+ * 加载时把小图片按行（shelf）装箱到若干张大纹理页中，使不同图片的精灵可以共享同一张纹理合批绘制。
+ * 每张图片四周保留 1 像素并复制边缘像素，避免线性过滤时采样到相邻图片。
+ * 图集页的空间只在 Clear 时整体回收。
+ */
+class TextureAtlas final {
+ public:
+  static constexpr int kPageSize = 2048;
+  static constexpr int kMaxRegionSize = 256;  // 超过该尺寸的图片单独成纹理
+  static constexpr int kPadding = 1;
+
+  explicit TextureAtlas(SDL_Renderer* renderer);
+  ~TextureAtlas();
+
+  TextureAtlas(const TextureAtlas& other) = delete;
+  TextureAtlas& operator=(const TextureAtlas& other) = delete;
+  TextureAtlas(TextureAtlas&& other) = delete;
+  TextureAtlas& operator=(TextureAtlas&& other) = delete;
+
+  [[nodiscard]] static bool Accepts(const SDL_Surface* surface);
+  // 把图片拷贝进某个图集页，失败时返回 std::nullopt，调用方应退回独立纹理
+  std::optional<TextureRegion> Insert(SDL_Surface* surface);
+  void Clear();
+
+  [[nodiscard]] size_t GetPageCount() const {
+    return pages_.size();
+  }
+
+ private:
+  struct Shelf {
+    int y = 0;
+    int height = 0;
+    int cursor_x = 0;
+  };
+
+  struct SDLTextureDeleter {
+    void operator()(SDL_Texture* texture) const {
+      if (texture) {
+        SDL_DestroyTexture(texture);
+      }
+    }
+  };
+
+  struct Page {
+    std::unique_ptr<SDL_Texture, SDLTextureDeleter> texture;
+    std::vector<Shelf> shelves;
+    int next_shelf_y = 0;
+  };
+
+  static std::optional<SDL_Point> Allocate(Page& page, int width, int height);
+  Page* CreatePage();
+  bool Upload(SDL_Texture* page_texture, SDL_Surface* surface, const SDL_Point& position) const;
+
+ private:
+  SDL_Renderer* renderer_;
+  std::vector<Page> pages_;
+};
+
+}  // namespace engine::resource
@@ -0,0 +1,37 @@
+#pragma once
+#include <SDL3/SDL_rect.h>
+#include <cstdint>
+#include <limits>
+
+struct SDL_Texture;
+
+namespace engine::resource {
+
+/**
+ * @brief 纹理句柄：指向 TextureManager 稠密纹理表的代际索引。
+ * index 定位槽位，generation 用于识别槽位被卸载/复用后遗留的过期句柄。
+ * 字符串路径只在加载时使用，每帧的查找通过句柄 O(1) 完成，无需哈希。
+ */
+struct TextureHandle {
+  static constexpr uint32_t kInvalidIndex = std::numeric_limits<uint32_t>::max();
+
+  uint32_t index = kInvalidIndex;
+  uint32_t generation = 0;
+
+  [[nodiscard]] bool IsValid() const {
+    return index != kInvalidIndex;
+  }
+
+  friend bool operator==(const TextureHandle&, const TextureHandle&) = default;
+};
+
+/**
+ * @brief 纹理区域：一张图片实际所在的 GPU 纹理及其中的像素矩形。
+ * 打进图集的图片指向图集页，独立纹理的 rect 覆盖整张纹理。
+ */
+struct TextureRegion {
+  SDL_Texture* texture = nullptr;
+  SDL_FRect rect = {0.0f, 0.0f, 0.0f, 0.0f};
+};
+
+}  // namespace engine::resource
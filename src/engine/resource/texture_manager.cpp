@@ -1,63 +1,219 @@
 #include "texture_manager.h"
 #include "logger.hpp"
+#include "utils/profiler.h"
 
 #include <SDL3_image/SDL_image.h>
+#include <algorithm>
+#include <ranges>
 
 namespace engine::resource {
 namespace {
 DECLARE_TAG(TextureManager);
 }
 
-TextureManager::TextureManager(SDL_Renderer* renderer) : renderer_(renderer) {
+TextureManager::TextureManager(SDL_Renderer* renderer)
+    : renderer_(renderer), atlas_(renderer), main_thread_id_(std::this_thread::get_id()) {
   TRACEI(TAG);
   if (renderer_ == nullptr) {
     throw std::invalid_argument("SDL_Renderer is null");
   }
 }
 TextureManager::~TextureManager() = default;
-SDL_Texture* TextureManager::LoadTexture(const std::string& file_path) {
-  if (textures_.contains(file_path)) {
-    return textures_.at(file_path).get();
+TextureHandle TextureManager::LoadTexture(const std::string& file_path) {
+  if (const auto it = handles_.find(file_path); it != handles_.end()) {
+    return it->second;
+  }
+  if (failed_paths_.contains(file_path)) {
+    return {};
+  }
+  if (!IsMainThread()) {
+    // 流水线模式下模拟和录制在工作线程上，纹理应预加载或在场景 Init 中加载
+    LOGW(TAG, "LoadTexture called off the main thread: {}, queued for the main thread", file_path);
+    RequestLoad(file_path);
+    return {};
   }
 
-  SDL_Texture* raw_texture = IMG_LoadTexture(renderer_, file_path.c_str());
-  if (raw_texture == nullptr) {
-    LOGE(TAG, "Failed to load texture: {}", file_path);
-    return nullptr;
+  PROFILE_SCOPE("TextureManager::LoadTexture");
+  SDL_Surface* surface = IMG_Load(file_path.c_str());
+  if (surface == nullptr) {
+    // 坏资源只报一次，之后不再每帧重试加载
+    LOGE(TAG, "Failed to load texture: {}, error: {}, it will not be retried", file_path, SDL_GetError());
+    failed_paths_.insert(file_path);
+    return {};
+  }
+  const auto handle = AddTexture(file_path, surface);
+  SDL_DestroySurface(surface);
+  if (!handle.IsValid()) {
+    failed_paths_.insert(file_path);
+  }
+  return handle;
+}
+
+TextureHandle TextureManager::FindTexture(const std::string& file_path) {
+  if (const auto it = handles_.find(file_path); it != handles_.end()) {
+    return it->second;
+  }
+  if (!failed_paths_.contains(file_path)) {
+    RequestLoad(file_path);
+  }
+  return {};
+}
+
+TextureHandle TextureManager::AddTexture(const std::string& file_path, SDL_Surface* surface) {
+  if (const auto it = handles_.find(file_path); it != handles_.end()) {
+    return it->second;
+  }
+
+  TextureSlot loaded;
+  if (!CreateFromSurface(surface, loaded)) {
+    LOGE(TAG, "Failed to create texture: {}", file_path);
+    return {};
   }
-  textures_.emplace(file_path, std::unique_ptr<SDL_Texture, SDLTextureDeleter>(raw_texture));
+  const auto handle = InsertSlot(file_path, std::move(loaded));
   LOGI(TAG, "Loaded texture: {}", file_path);
-  return raw_texture;
+  return handle;
+}
+
+bool TextureManager::HasTexture(const std::string& file_path) const {
+  return handles_.contains(file_path);
+}
+
+SDL_Texture* TextureManager::GetTexture(TextureHandle handle) const {
+  const auto slot = FindSlot(handle);
+  return slot ? slot->region.texture : nullptr;
 }
 
 SDL_Texture* TextureManager::GetTexture(const std::string& file_path) {
-  if (textures_.contains(file_path)) {
-    return textures_.at(file_path).get();
-  }
-  LOGW(TAG, "Texture not found: {}, try to load it", file_path);
-  return LoadTexture(file_path);
+  return GetTextureRegion(file_path).texture;
+}
+
+TextureRegion TextureManager::GetTextureRegion(TextureHandle handle) const {
+  const auto slot = FindSlot(handle);
+  return slot ? slot->region : TextureRegion{};
+}
+
+TextureRegion TextureManager::GetTextureRegion(const std::string& file_path) {
+  return GetTextureRegion(FindTexture(file_path));
 }
 
 void TextureManager::UnloadTexture(const std::string& file_path) {
-  if (textures_.contains(file_path)) {
-    textures_.erase(file_path);
+  if (!IsMainThread()) {
+    std::lock_guard lock(pending_mutex_);
+    pending_unloads_.push_back(file_path);
+    return;
+  }
+  if (const auto it = handles_.find(file_path); it != handles_.end()) {
+    // 图集中的区域只释放槽位，图集页空间在 ClearTextures 时统一回收
+    ReleaseSlot(it->second.index);
+    handles_.erase(it);
     LOGI(TAG, "Unloaded texture: {}", file_path);
   } else {
     LOGW(TAG, "Texture not found: {}, cannot unload", file_path);
   }
 }
 void TextureManager::ClearTextures() {
-  textures_.clear();
+  for (const auto& handle : handles_ | std::views::values) {
+    ReleaseSlot(handle.index);
+  }
+  handles_.clear();
+  failed_paths_.clear();
+  retired_textures_.clear();
+  atlas_.Clear();
   LOGI(TAG, "Cleared all textures");
 }
+void TextureManager::ProcessPendingRequests() {
+  // 上一次同步点之后退役的纹理只可能被已经提交的帧引用，现在可以销毁
+  retired_textures_.clear();
+
+  std::vector<std::string> loads;
+  std::vector<std::string> unloads;
+  {
+    std::lock_guard lock(pending_mutex_);
+    loads.swap(pending_loads_);
+    unloads.swap(pending_unloads_);
+  }
+  for (const auto& file_path : unloads) {
+    UnloadTexture(file_path);
+  }
+  for (const auto& file_path : loads) {
+    LoadTexture(file_path);
+  }
+}
+glm::vec2 TextureManager::GetTextureSize(TextureHandle handle) const {
+  const auto slot = FindSlot(handle);
+  return slot ? slot->size : glm::vec2(0.0f);
+}
 glm::vec2 TextureManager::GetTextureSize(const std::string& file_path) {
-  const auto texture = GetTexture(file_path);
-  if (texture == nullptr) {
+  const auto handle = LoadTexture(file_path);
+  if (!handle.IsValid()) {
     LOGW(TAG, "Texture not found: {}, cannot get size", file_path);
     return glm::vec2(0.0f);
   }
-  glm::vec2 size;
-  SDL_GetTextureSize(texture, &size.x, &size.y);
-  return size;
+  return GetTextureSize(handle);
+}
+const TextureManager::TextureSlot* TextureManager::FindSlot(TextureHandle handle) const {
+  if (handle.index >= slots_.size()) {
+    return nullptr;
+  }
+  const auto& slot = slots_[handle.index];
+  if (slot.generation != handle.generation || slot.region.texture == nullptr) {
+    return nullptr;
+  }
+  return &slot;
+}
+void TextureManager::ReleaseSlot(uint32_t index) {
+  auto& slot = slots_[index];
+  if (slot.owned_texture) {
+    retired_textures_.push_back(std::move(slot.owned_texture));
+  }
+  slot.region = {};
+  slot.size = glm::vec2(0.0f);
+  // 代际递增后，所有指向该槽位的旧句柄都会失效
+  ++slot.generation;
+  free_slots_.push_back(index);
+}
+bool TextureManager::CreateFromSurface(SDL_Surface* surface, TextureSlot& slot) {
+  if (surface == nullptr) {
+    return false;
+  }
+  slot.size = {static_cast<float>(surface->w), static_cast<float>(surface->h)};
+
+  if (auto region = atlas_.Insert(surface); region.has_value()) {
+    slot.region = region.value();
+    return true;
+  }
+  SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer_, surface);
+  if (texture == nullptr) {
+    LOGE(TAG, "Failed to create texture from surface: {}", SDL_GetError());
+    return false;
+  }
+  slot.owned_texture.reset(texture);
+  slot.region = {texture, {0.0f, 0.0f, slot.size.x, slot.size.y}};
+  return true;
+}
+void TextureManager::RequestLoad(const std::string& file_path) {
+  std::lock_guard lock(pending_mutex_);
+  if (std::ranges::find(pending_loads_, file_path) == pending_loads_.end()) {
+    LOGD(TAG, "Texture not loaded yet: {}, queued for the main thread", file_path);
+    pending_loads_.push_back(file_path);
+  }
+}
+TextureHandle TextureManager::InsertSlot(const std::string& file_path, TextureSlot&& loaded) {
+  uint32_t index = 0;
+  if (!free_slots_.empty()) {
+    index = free_slots_.back();
+    free_slots_.pop_back();
+  } else {
+    index = static_cast<uint32_t>(slots_.size());
+    slots_.emplace_back();
+  }
+  auto& slot = slots_[index];
+  slot.owned_texture = std::move(loaded.owned_texture);
+  slot.region = loaded.region;
+  slot.size = loaded.size;
+
+  const TextureHandle handle{index, slot.generation};
+  handles_.emplace(file_path, handle);
+  return handle;
 }
 }  // namespace engine::resource
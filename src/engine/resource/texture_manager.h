@@ -2,12 +2,26 @@
 #include <SDL3/SDL_render.h>
 #include <glm/glm.hpp>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "texture_atlas.h"
+#include "texture_handle.h"
 
 struct SDL_Texture;
 
 namespace engine::resource {
 
+/**
+ * @brief 纹理表。SDL 纹理只能在主线程创建和销毁，而流水线模式下渲染命令在工作线程上录制：
+ * - 加载、卸载在主线程执行；其他线程调用时只登记请求，由主线程在 ProcessPendingRequests 中处理；
+ * - 按路径查找（FindTexture / GetTextureRegion(path)）只查表不加载，未命中时登记加载请求，之后的帧可用；
+ * - 卸载的独立纹理先退役，等已录制的帧提交之后（下一次 ProcessPendingRequests）才真正销毁。
+ * 主线程只在帧同步点（没有线程在录制时）修改纹理表，所以录制线程的只读查找不加锁。
+ */
 class TextureManager final {
  public:
   explicit TextureManager(SDL_Renderer* renderer);
@@ -20,10 +34,26 @@ class TextureManager final {
   ~TextureManager();
 
  public:
-  SDL_Texture* LoadTexture(const std::string& file_path);
+  // 加载阶段：按路径查找或加载，返回句柄。非主线程调用时等同于 FindTexture
+  TextureHandle LoadTexture(const std::string& file_path);
+  // 只查找不加载，未命中时登记到主线程的加载队列并返回无效句柄
+  TextureHandle FindTexture(const std::string& file_path);
+  // 用已解码的图片创建纹理（异步加载的主线程上传阶段），不接管 surface 的所有权
+  TextureHandle AddTexture(const std::string& file_path, SDL_Surface* surface);
+  [[nodiscard]] bool HasTexture(const std::string& file_path) const;
+  // 运行阶段：句柄直接索引纹理表，过期或无效句柄返回 nullptr
+  // 打进图集的图片返回的是整张图集页，绘制时需配合 GetTextureRegion 的矩形使用
+  SDL_Texture* GetTexture(TextureHandle handle) const;
   SDL_Texture* GetTexture(const std::string& file_path);
+  TextureRegion GetTextureRegion(TextureHandle handle) const;
+  TextureRegion GetTextureRegion(const std::string& file_path);
+  // 句柄立即失效，纹理本体延后到下一次 ProcessPendingRequests 销毁
   void UnloadTexture(const std::string& file_path);
+  // 立即销毁全部纹理，只能在没有待提交帧时调用（如退出时）
   void ClearTextures();
+  // 主线程在帧同步点调用：销毁上一帧退役的纹理，处理其他线程登记的卸载和加载请求
+  void ProcessPendingRequests();
+  glm::vec2 GetTextureSize(TextureHandle handle) const;
   glm::vec2 GetTextureSize(const std::string& file_path);
 
  private:
@@ -34,7 +64,37 @@ class TextureManager final {
       }
     }
   };
-  std::unordered_map<std::string, std::unique_ptr<SDL_Texture, SDLTextureDeleter>> textures_;
+
+  struct TextureSlot {
+    // 独立纹理由槽位持有；图集中的图片只引用图集页，owned_texture 为空
+    std::unique_ptr<SDL_Texture, SDLTextureDeleter> owned_texture;
+    TextureRegion region;
+    glm::vec2 size = {0.0f, 0.0f};
+    uint32_t generation = 0;
+  };
+
+  [[nodiscard]] const TextureSlot* FindSlot(TextureHandle handle) const;
+  void ReleaseSlot(uint32_t index);
+  // 小图打进图集，大图创建独立纹理
+  bool CreateFromSurface(SDL_Surface* surface, TextureSlot& slot);
+  TextureHandle InsertSlot(const std::string& file_path, TextureSlot&& loaded);
+  void RequestLoad(const std::string& file_path);
+  [[nodiscard]] bool IsMainThread() const {
+    return std::this_thread::get_id() == main_thread_id_;
+  }
+
+  std::vector<TextureSlot> slots_;
+  std::vector<uint32_t> free_slots_;
+  std::unordered_map<std::string, TextureHandle> handles_;
+  std::unordered_set<std::string> failed_paths_;  // 加载失败过的路径，ClearTextures 前不再重试
   SDL_Renderer* renderer_;
+  TextureAtlas atlas_;
+  std::thread::id main_thread_id_;  // 构造所在线程即主线程
+
+  // 已卸载但可能仍被待提交帧引用的纹理
+  std::vector<std::unique_ptr<SDL_Texture, SDLTextureDeleter>> retired_textures_;
+  std::mutex pending_mutex_;  // 只保护下面两个请求队列
+  std::vector<std::string> pending_loads_;
+  std::vector<std::string> pending_unloads_;
 };
 }  // namespace engine::resource
@@ -0,0 +1,330 @@
+#include "level_loader.h"
+#include "component/parallax_component.h"
+#include "component/tilelayer_component.h"
+#include "component/transform_component.h"
+#include "core/context.h"
+#include "logger.hpp"
+#include "object/game_object.h"
+#include "scene.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <unordered_set>
+
+namespace engine::scene {
+namespace {
+DECLARE_TAG(LevelLoader);
+// Tiled 在 gid 的高位存放翻转标志
+constexpr uint32_t kFlippedHorizontallyFlag = 0x80000000;
+constexpr uint32_t kFlippedVerticallyFlag = 0x40000000;
+constexpr uint32_t kGidFlagsMask = 0xF0000000;
+
+// gid 必须是 32 位无符号整数，其他值（负数、小数、字符串等）返回 false，调用方按空瓦片处理
+bool ReadGid(const nlohmann::json& gid_json, uint32_t& gid) {
+  if (!gid_json.is_number_unsigned() || gid_json.get<uint64_t>() > std::numeric_limits<uint32_t>::max()) {
+    gid = 0;
+    return false;
+  }
+  gid = gid_json.get<uint32_t>();
+  return true;
+}
+}  // namespace
+
+bool LevelLoader::ParseMap(const std::string& map_path, nlohmann::json& json_data) {
+  // 重新解析会替换图块集，之前缓存的地图不再对应
+  parsed_map_path_.clear();
+  parsed_map_json_ = nullptr;
+  std::ifstream file(map_path);
+  if (!file.is_open()) {
+    LOGE(TAG, "Failed to open level file: {}!", map_path);
+    return false;
+  }
+
+  try {
+    file >> json_data;
+  } catch (const nlohmann::json::parse_error& e) {
+    LOGE(TAG, "Failed to parse level file: {}! Error: {}", map_path, e.what());
+    return false;
+  }
+
+  if (json_data.value("infinite", false)) {
+    LOGE(TAG, "Infinite maps are not supported: {}!", map_path);
+    return false;
+  }
+
+  map_directory_ = std::filesystem::path(map_path).parent_path().string();
+  map_size_ = {json_data.value("width", 0), json_data.value("height", 0)};
+  tile_size_ = {json_data.value("tilewidth", 0), json_data.value("tileheight", 0)};
+
+  tilesets_.clear();
+  if (json_data.contains("tilesets") && json_data["tilesets"].is_array()) {
+    for (const auto& tileset_ref : json_data["tilesets"]) {
+      if (!LoadTileset(tileset_ref)) {
+        LOGE(TAG, "Failed to load tileset referenced by {}!", map_path);
+      }
+    }
+  }
+  std::sort(tilesets_.begin(), tilesets_.end(),
+            [](const TilesetData& a, const TilesetData& b) { return a.first_gid < b.first_gid; });
+  return true;
+}
+
+bool LevelLoader::CollectTexturePaths(const std::string& map_path, std::vector<std::string>& texture_paths) {
+  nlohmann::json json_data;
+  if (!ParseMap(map_path, json_data) || !json_data.contains("layers") || !json_data["layers"].is_array()) {
+    return false;
+  }
+
+  std::unordered_set<std::string> seen_paths;
+  const auto add_path = [&](const std::string& path) {
+    if (!path.empty() && seen_paths.insert(path).second) {
+      texture_paths.push_back(path);
+    }
+  };
+  for (const auto& layer_json : json_data["layers"]) {
+    if (!layer_json.value("visible", true)) {
+      continue;
+    }
+    const std::string layer_type = layer_json.value("type", "none");
+    if (layer_type == "imagelayer") {
+      const std::string image_path = layer_json.value("image", "");
+      if (!image_path.empty()) {
+        add_path(ResolvePath(map_directory_, image_path));
+      }
+    } else if (layer_type == "tilelayer" && layer_json.contains("data") && layer_json["data"].is_array()) {
+      // 只收集图层实际用到的瓦片图片，同一 gid 只解析一次
+      std::unordered_set<uint32_t> seen_gids;
+      for (const auto& gid_json : layer_json["data"]) {
+        uint32_t gid = 0;
+        ReadGid(gid_json, gid);
+        gid &= ~kGidFlagsMask;
+        if (gid != 0 && seen_gids.insert(gid).second) {
+          add_path(GetTileInfoByGid(gid).sprite.GetTextureId());
+        }
+      }
+    }
+  }
+  parsed_map_path_ = map_path;
+  parsed_map_json_ = std::move(json_data);
+  return true;
+}
+
+bool LevelLoader::LoadLevel(const std::string& map_path, Scene& scene) {
+  nlohmann::json json_data;
+  if (!parsed_map_path_.empty() && parsed_map_path_ == map_path) {
+    // 预加载时已经解析过（图块集也已加载），直接复用
+    json_data = std::move(parsed_map_json_);
+    parsed_map_path_.clear();
+    parsed_map_json_ = nullptr;
+  } else if (!ParseMap(map_path, json_data)) {
+    return false;
+  }
+
+  if (!json_data.contains("layers") || !json_data["layers"].is_array()) {
+    LOGE(TAG, "Level file has no layers: {}!", map_path);
+    return false;
+  }
+  for (const auto& layer_json : json_data["layers"]) {
+    if (!layer_json.value("visible", true)) {
+      LOGD(TAG, "Skip hidden layer: {}", layer_json.value("name", "Unnamed"));
+      continue;
+    }
+    const std::string layer_type = layer_json.value("type", "none");
+    if (layer_type == "imagelayer") {
+      LoadImageLayer(layer_json, scene);
+    } else if (layer_type == "tilelayer") {
+      LoadTileLayer(layer_json, scene);
+    } else {
+      LOGW(TAG, "Unsupported layer type: {} ({})", layer_type, layer_json.value("name", "Unnamed"));
+    }
+  }
+
+  LOGI(TAG, "Loaded level: {}, map size: {}x{}, tile size: {}x{}", map_path, map_size_.x, map_size_.y, tile_size_.x,
+       tile_size_.y);
+  return true;
+}
+
+void LevelLoader::LoadImageLayer(const nlohmann::json& layer_json, Scene& scene) const {
+  const std::string image_path = layer_json.value("image", "");
+  if (image_path.empty()) {
+    LOGW(TAG, "Image layer {} has no image", layer_json.value("name", "Unnamed"));
+    return;
+  }
+  const std::string texture_id = ResolvePath(map_directory_, image_path);
+  const glm::vec2 offset = {layer_json.value("offsetx", 0.0f), layer_json.value("offsety", 0.0f)};
+  const glm::vec2 scroll_factor = {layer_json.value("parallaxx", 1.0f), layer_json.value("parallaxy", 1.0f)};
+  const glm::bvec2 repeat = {layer_json.value("repeatx", false), layer_json.value("repeaty", false)};
+  const std::string layer_name = layer_json.value("name", "Unnamed");
+
+  auto game_object = std::make_unique<engine::object::GameObject>(layer_name);
+  game_object->AddComponent<engine::component::TransformComponent>(offset);
+  game_object->AddComponent<engine::component::ParallaxComponent>(
+      texture_id, scene.GetContext().GetResourceManager(), scroll_factor, repeat);
+  scene.AddGameObject(std::move(game_object));
+  LOGD(TAG, "Loaded image layer: {}", layer_name);
+}
+
+void LevelLoader::LoadTileLayer(const nlohmann::json& layer_json, Scene& scene) const {
+  const std::string layer_name = layer_json.value("name", "Unnamed");
+  if (!layer_json.contains("data") || !layer_json["data"].is_array()) {
+    LOGE(TAG, "Tile layer {} has no array data (only CSV encoding is supported)", layer_name);
+    return;
+  }
+
+  // 同一个 gid（含翻转标志）只解析一次，格子里只存它在调色板中的下标
+  const auto& data = layer_json["data"];
+  std::vector<engine::component::TileInfo> tile_palette(1);  // 0 号为空瓦片
+  std::unordered_map<uint32_t, uint32_t> palette_indices;
+  std::vector<uint32_t> tile_indices;
+  tile_indices.reserve(data.size());
+  size_t invalid_count = 0;
+  for (const auto& gid_json : data) {
+    uint32_t gid = 0;
+    if (!ReadGid(gid_json, gid)) {
+      ++invalid_count;
+    }
+    if ((gid & ~kGidFlagsMask) == 0) {
+      tile_indices.push_back(0);
+      continue;
+    }
+    const auto [it, inserted] = palette_indices.try_emplace(gid, static_cast<uint32_t>(tile_palette.size()));
+    if (inserted) {
+      auto info = GetTileInfoByGid(gid);
+      if (info.type == engine::component::TileType::EMPTY) {
+        it->second = 0;
+      } else {
+        tile_palette.push_back(std::move(info));
+      }
+    }
+    tile_indices.push_back(it->second);
+  }
+  if (invalid_count > 0) {
+    LOGW(TAG, "Tile layer {} has {} invalid gid(s), treated as empty", layer_name, invalid_count);
+  }
+
+  const glm::ivec2 layer_size = {layer_json.value("width", map_size_.x), layer_json.value("height", map_size_.y)};
+  auto game_object = std::make_unique<engine::object::GameObject>(layer_name);
+  auto tile_layer =
+      game_object->AddComponent<engine::component::TileLayerComponent>(tile_size_, layer_size, std::move(tile_palette),
+                                                                       std::move(tile_indices),
+                                                                       scene.GetContext().GetResourceManager());
+  tile_layer->SetOffset({layer_json.value("offsetx", 0.0f), layer_json.value("offsety", 0.0f)});
+  scene.AddGameObject(std::move(game_object));
+  LOGD(TAG, "Loaded tile layer: {}", layer_name);
+}
+
+bool LevelLoader::LoadTileset(const nlohmann::json& tileset_ref) {
+  TilesetData tileset;
+  tileset.first_gid = tileset_ref.value("firstgid", 0);
+  if (tileset_ref.contains("source")) {
+    const std::string tileset_path = ResolvePath(map_directory_, tileset_ref["source"].get<std::string>());
+    std::ifstream file(tileset_path);
+    if (!file.is_open()) {
+      LOGE(TAG, "Failed to open tileset file: {}!", tileset_path);
+      return false;
+    }
+    try {
+      file >> tileset.json;
+    } catch (const nlohmann::json::parse_error& e) {
+      LOGE(TAG, "Failed to parse tileset file: {}! Error: {}", tileset_path, e.what());
+      return false;
+    }
+    tileset.directory = std::filesystem::path(tileset_path).parent_path().string();
+  } else {
+    // 内嵌在地图中的图块集
+    tileset.json = tileset_ref;
+    tileset.directory = map_directory_;
+  }
+  if (tileset.json.contains("tiles") && tileset.json["tiles"].is_array()) {
+    const auto& tiles = tileset.json["tiles"];
+    for (size_t i = 0; i < tiles.size(); ++i) {
+      tileset.tile_indices.emplace(tiles[i].value("id", -1), i);
+    }
+  }
+  tilesets_.push_back(std::move(tileset));
+  return true;
+}
+
+engine::component::TileInfo LevelLoader::GetTileInfoByGid(uint32_t gid) const {
+  using engine::component::TileInfo;
+  using engine::component::TileType;
+
+  const bool flip_horizontal = (gid & kFlippedHorizontallyFlag) != 0;
+  const bool flip_vertical = (gid & kFlippedVerticallyFlag) != 0;
+  gid &= ~kGidFlagsMask;
+  if (gid == 0) {
+    return TileInfo();
+  }
+
+  const auto tileset = FindTileset(gid);
+  if (tileset == nullptr) {
+    LOGW(TAG, "No tileset found for gid {}", gid);
+    return TileInfo();
+  }
+  const auto& json = tileset->json;
+  const int local_id = static_cast<int>(gid) - tileset->first_gid;
+
+  const nlohmann::json* tile_json = nullptr;
+  if (const auto it = tileset->tile_indices.find(local_id); it != tileset->tile_indices.end()) {
+    tile_json = &json["tiles"][it->second];
+  }
+  const TileType type = (tile_json && IsSolidTile(*tile_json)) ? TileType::SOLID : TileType::NORMAL;
+
+  TileInfo info;
+  if (json.contains("image")) {
+    // 单张图片的图块集：按列数和间距计算源矩形
+    const int columns = std::max(1, json.value("columns", 1));
+    const int tile_w = json.value("tilewidth", tile_size_.x);
+    const int tile_h = json.value("tileheight", tile_size_.y);
+    const int margin = json.value("margin", 0);
+    const int spacing = json.value("spacing", 0);
+    const SDL_FRect src_rect = {static_cast<float>(margin + (local_id % columns) * (tile_w + spacing)),
+                                static_cast<float>(margin + (local_id / columns) * (tile_h + spacing)),
+                                static_cast<float>(tile_w), static_cast<float>(tile_h)};
+    info = TileInfo(engine::render::Sprite(ResolvePath(tileset->directory, json["image"].get<std::string>()), src_rect),
+                    type);
+    info.size = {static_cast<float>(tile_w), static_cast<float>(tile_h)};
+  } else if (tile_json && tile_json->contains("image")) {
+    // 图片集合类型的图块集：每个瓦片一张独立图片
+    info = TileInfo(engine::render::Sprite(ResolvePath(tileset->directory, (*tile_json)["image"].get<std::string>())),
+                    type);
+    info.size = {tile_json->value("imagewidth", 0.0f), tile_json->value("imageheight", 0.0f)};
+  } else {
+    LOGW(TAG, "Tile gid {} has no image", gid);
+    return TileInfo();
+  }
+  info.flip_horizontal = flip_horizontal;
+  info.flip_vertical = flip_vertical;
+  return info;
+}
+
+const LevelLoader::TilesetData* LevelLoader::FindTileset(uint32_t gid) const {
+  // tilesets_ 按 first_gid 升序，取最后一个 first_gid <= gid 的图块集
+  const auto it = std::upper_bound(
+      tilesets_.begin(), tilesets_.end(), gid,
+      [](uint32_t value, const TilesetData& t) { return value < static_cast<uint32_t>(t.first_gid); });
+  if (it == tilesets_.begin()) {
+    return nullptr;
+  }
+  return &*std::prev(it);
+}
+
+bool LevelLoader::IsSolidTile(const nlohmann::json& tile_json) {
+  if (!tile_json.contains("properties") || !tile_json["properties"].is_array()) {
+    return false;
+  }
+  for (const auto& property : tile_json["properties"]) {
+    if (property.value("name", "") == "solid" && property.value("type", "") == "bool") {
+      return property.value("value", false);
+    }
+  }
+  return false;
+}
+
+std::string LevelLoader::ResolvePath(const std::string& directory, const std::string& relative_path) {
+  return (std::filesystem::path(directory) / relative_path).lexically_normal().generic_string();
+}
+
+}  // namespace engine::scene
@@ -0,0 +1,69 @@
+#pragma once
+#include <SDL3/SDL_rect.h>
+#include <glm/glm.hpp>
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace engine::component {
+struct TileInfo;
+}  // namespace engine::component
+
+namespace engine::scene {
+class Scene;
+
+/**
+ * @brief 读取 Tiled 导出的 .tmj 地图（及其引用的 .tsj 图块集），把图层转换为场景中的游戏对象。
+ * - 图片图层 -> TransformComponent + ParallaxComponent
+ * - 瓦片图层 -> TileLayerComponent（分块缓存渲染）
+ * 对象图层暂不支持，会被跳过。
+ * CollectTexturePaths 可以在加载线程上调用，解析结果会保留给随后同一路径的 LoadLevel 复用；
+ * 同一个实例不能被多个线程同时使用。
+ */
+class LevelLoader final {
+ public:
+  LevelLoader() = default;
+
+  [[nodiscard]] bool LoadLevel(const std::string& map_path, Scene& scene);
+  // 只解析地图，收集它引用的全部纹理路径（去重），供场景切换前异步预加载。解析结果留给 LoadLevel
+  [[nodiscard]] bool CollectTexturePaths(const std::string& map_path, std::vector<std::string>& texture_paths);
+
+  [[nodiscard]] const glm::ivec2& GetMapSize() const {
+    return map_size_;
+  }
+  [[nodiscard]] const glm::ivec2& GetTileSize() const {
+    return tile_size_;
+  }
+
+ private:
+  struct TilesetData {
+    int first_gid = 0;
+    std::string directory;  // 图块集文件所在目录，用于解析其中的相对图片路径
+    nlohmann::json json;
+    std::unordered_map<int, size_t> tile_indices;  // 瓦片 id -> json["tiles"] 中的下标，避免逐个查找
+  };
+
+  // 读取地图文件并加载图块集，LoadLevel 和 CollectTexturePaths 共用
+  bool ParseMap(const std::string& map_path, nlohmann::json& json_data);
+  void LoadImageLayer(const nlohmann::json& layer_json, Scene& scene) const;
+  void LoadTileLayer(const nlohmann::json& layer_json, Scene& scene) const;
+  bool LoadTileset(const nlohmann::json& tileset_ref);
+
+  [[nodiscard]] engine::component::TileInfo GetTileInfoByGid(uint32_t gid) const;
+  [[nodiscard]] const TilesetData* FindTileset(uint32_t gid) const;
+  [[nodiscard]] static bool IsSolidTile(const nlohmann::json& tile_json);
+  [[nodiscard]] static std::string ResolvePath(const std::string& directory, const std::string& relative_path);
+
+ private:
+  std::string map_directory_;
+  glm::ivec2 map_size_ = {0, 0};
+  glm::ivec2 tile_size_ = {0, 0};
+  std::vector<TilesetData> tilesets_;  // 按 first_gid 升序
+  // CollectTexturePaths 解析过的地图，LoadLevel 同一路径时直接使用，不再读文件
+  std::string parsed_map_path_;
+  nlohmann::json parsed_map_json_;
+};
+
+}  // namespace engine::scene
@@ -1,12 +1,21 @@
 #include "scene.h"
+#include "component/component_storage.h"
+#include "component/transform_component.h"
+#include "core/context.h"
 #include "logger.hpp"
 #include "object/game_object.h"
+#include "render/camera.h"
+#include "resource/async_loader.h"
 #include "scene_manager.h"
 
 #include <algorithm>
 namespace engine::scene {
 namespace {
 DECLARE_TAG(Scene);
+// 空位超过对象数组的这个比例时才压缩，压缩的 O(n) 开销均摊到每次移除上是 O(1)
+constexpr size_t kCompactDivisor = 4;
+// 剔除时视口四周放宽的距离：渲染用的是插值位置，旋转后的精灵也会超出未旋转的包围盒
+constexpr float kCullingMargin = 32.0f;
 }  // namespace
 
 Scene::Scene(std::string name, engine::core::Context& context, engine::scene::SceneManager& scene_manager)
@@ -25,17 +34,9 @@ void Scene::Update(double delta_time_s) {
   if (!is_initialized_)
     return;
 
-  for (auto it = game_objects_.begin(); it != game_objects_.end();) {
-    if (*it && !(*it)->IsNeedRemove()) {
-      (*it)->Update(delta_time_s, context_);
-      ++it;
-    } else {
-      if (*it) {
-        (*it)->Clean();
-      }
-      it = game_objects_.erase(it);
-    }
-  }
+  // 按组件类型线性遍历各自的存储，而不是逐个对象查组件表
+  engine::component::ComponentRegistry::UpdateAll(delta_time_s, context_, this);
+  RemovePendingGameObjects();
 
   ProcessPendingAdditions();
 }
@@ -44,9 +45,21 @@ void Scene::Render() {
   if (!is_initialized_)
     return;
 
-  for (const auto& obj : game_objects_) {
-    if (obj)
-      obj->Render(context_);
+  // 可见性阶段：可剔除对象只取空间索引中与视口相交的，视口外的对象不进入任何组件的 Render
+  render_list_.assign(unculled_objects_.begin(), unculled_objects_.end());
+  const auto unculled_count = static_cast<std::ptrdiff_t>(render_list_.size());
+  spatial_grid_.Query(GetVisibleArea(), render_list_);
+  // 有变换组件的不可剔除对象也登记在索引里，它们已经在列表前部
+  render_list_.erase(std::remove_if(render_list_.begin() + unculled_count, render_list_.end(),
+                                    [](const engine::object::GameObject* obj) { return !obj->IsCullable(); }),
+                     render_list_.end());
+  // 保持与对象数组一致的渲染顺序
+  std::sort(render_list_.begin(), render_list_.end(),
+            [](const engine::object::GameObject* a, const engine::object::GameObject* b) {
+              return a->scene_index_ < b->scene_index_;
+            });
+  for (auto* obj : render_list_) {
+    obj->Render(context_);
   }
 }
 
@@ -54,16 +67,8 @@ void Scene::HandleInput() {
   if (!is_initialized_)
     return;
 
-  for (auto it = game_objects_.begin(); it != game_objects_.end();) {
-    if (*it && !(*it)->IsNeedRemove()) {
-      (*it)->HandleInput(context_);
-      ++it;
-    } else {
-      if (*it)
-        (*it)->Clean();
-      it = game_objects_.erase(it);
-    }
-  }
+  // 输入阶段标记的移除留到 Update 末尾统一处理，每帧只清理一次
+  engine::component::ComponentRegistry::HandleInputAll(context_, this);
 }
 
 void Scene::Clean() {
@@ -74,17 +79,55 @@ void Scene::Clean() {
     if (obj)
       obj->Clean();
   }
+  for (auto& slot : handle_slots_) {
+    if (slot.object != nullptr) {
+      ReleaseHandle(slot.object->handle_);
+    }
+  }
   game_objects_.clear();
+  game_objects_.shrink_to_fit();
+  spatial_grid_.Clear();
+  unculled_objects_.clear();
+  render_list_.clear();
+  removed_count_ = 0;
+  pending_removals_.clear();
+  name_index_.clear();
+  tag_index_.clear();
+  pending_additions_.clear();
+  pending_additions_.shrink_to_fit();
+  // 对象和组件都来自全局的定长块池，池空了就整体还给系统（场景栈里其他场景还有对象时保留）
+  engine::object::GameObject::ReleasePoolMemory();
+  engine::component::ComponentRegistry::ReleaseUnusedMemory();
 
   is_initialized_ = false;
   LOGT(TAG, "scene {} clean succeeded", scene_name_);
 }
 
+std::function<engine::resource::PreloadSet()> Scene::GetPreloadCollector() const {
+  return nullptr;
+}
+
 void Scene::AddGameObject(std::unique_ptr<engine::object::GameObject>&& game_object) {
-  if (game_object) {
-    game_objects_.push_back(std::move(game_object));
-  } else {
+  if (!game_object) {
     LOGW(TAG, "try to add null game object to scene {}", scene_name_);
+    return;
+  }
+  auto* object = game_object.get();
+  object->SetScene(this);
+  if (auto* transform = object->GetComponent<engine::component::TransformComponent>()) {
+    transform->AttachToSpatialGrid(spatial_grid_);
+  }
+  object->scene_index_ = static_cast<uint32_t>(game_objects_.size());
+  object->handle_ = AcquireHandle(object);
+  IndexInsert(name_index_, object->name_id_, object, &engine::object::GameObject::name_index_slot_);
+  IndexInsert(tag_index_, object->tag_id_, object, &engine::object::GameObject::tag_index_slot_);
+  if (!object->is_cullable_) {
+    UnculledInsert(object);
+  }
+  game_objects_.push_back(std::move(game_object));
+  // 加入前就被标记移除的对象照常登记，本帧末尾清理
+  if (object->need_remove_) {
+    pending_removals_.push_back(object->handle_);
   }
 }
 
@@ -101,31 +144,205 @@ void Scene::RemoveGameObject(engine::object::GameObject* game_object_ptr) {
     LOGW(TAG, "try to remove null game object from scene {}", scene_name_);
     return;
   }
-
-  auto it = std::remove_if(
-      game_objects_.begin(), game_objects_.end(),
-      [game_object_ptr](const std::unique_ptr<engine::object::GameObject>& p) { return p.get() == game_object_ptr; });
-
-  if (it != game_objects_.end()) {
-    (*it)->Clean();
-    game_objects_.erase(it, game_objects_.end());
-    LOGT(TAG, "remove game obj from scene {}", scene_name_);
-  } else {
+  if (game_object_ptr->GetScene() != this) {
     LOGW(TAG, "did not find game object from scene {}", scene_name_);
+    return;
   }
+  DestroyGameObject(game_object_ptr);
+  LOGT(TAG, "remove game obj from scene {}", scene_name_);
 }
 
 void Scene::SafeRemoveGameObject(engine::object::GameObject* game_object_ptr) {
-  game_object_ptr->SetNeedRemove(true);
+  if (!game_object_ptr) {
+    LOGW(TAG, "try to remove null game object from scene {}", scene_name_);
+    return;
+  }
+  if (game_object_ptr->need_remove_) {
+    return;
+  }
+  game_object_ptr->need_remove_ = true;
+  if (game_object_ptr->GetScene() == this) {
+    pending_removals_.push_back(game_object_ptr->handle_);
+  }
+}
+
+engine::object::GameObject* Scene::GetGameObject(engine::object::GameObjectHandle handle) const {
+  if (handle.index >= handle_slots_.size()) {
+    return nullptr;
+  }
+  const auto& slot = handle_slots_[handle.index];
+  return slot.generation == handle.generation ? slot.object : nullptr;
 }
 
 engine::object::GameObject* Scene::FindGameObjectByName(const std::string& name) const {
-  for (const auto& obj : game_objects_) {
-    if (obj && obj->GetName() == name) {
-      return obj.get();
+  // 用 Find 而不是构造 StringId，查找不存在的名字不会往驻留表里塞字符串
+  return FindGameObjectByName(engine::utils::StringId::Find(name));
+}
+
+engine::object::GameObject* Scene::FindGameObjectByName(engine::utils::StringId name) const {
+  if (name.IsEmpty()) {
+    return nullptr;
+  }
+  const auto it = name_index_.find(name);
+  return it != name_index_.end() && !it->second.empty() ? it->second.front() : nullptr;
+}
+
+std::span<engine::object::GameObject* const> Scene::FindGameObjectsByTag(const std::string& tag) const {
+  return FindGameObjectsByTag(engine::utils::StringId::Find(tag));
+}
+
+std::span<engine::object::GameObject* const> Scene::FindGameObjectsByTag(engine::utils::StringId tag) const {
+  if (tag.IsEmpty()) {
+    return {};
+  }
+  const auto it = tag_index_.find(tag);
+  return it != tag_index_.end() ? std::span<engine::object::GameObject* const>(it->second)
+                                : std::span<engine::object::GameObject* const>();
+}
+
+void Scene::RemovePendingGameObjects() {
+  // 只处理本帧登记的对象，开销与移除数量成正比
+  for (const auto handle : pending_removals_) {
+    // 已经被 RemoveGameObject 立即移除（句柄失效），或登记后又被取消标记的对象跳过
+    auto* game_object = GetGameObject(handle);
+    if (game_object != nullptr && game_object->need_remove_) {
+      DestroyGameObject(game_object);
     }
   }
-  return nullptr;
+  pending_removals_.clear();
+
+  if (removed_count_ > 0 && removed_count_ * kCompactDivisor >= game_objects_.size()) {
+    CompactGameObjects();
+  }
+}
+
+void Scene::DestroyGameObject(engine::object::GameObject* game_object) {
+  // 留下空位而不是 erase，保持其余对象的顺序（渲染顺序依赖它）且不搬动后面的元素
+  const uint32_t index = game_object->scene_index_;
+  game_object->Clean();
+  game_object->SetScene(nullptr);
+  ReleaseHandle(game_object->handle_);
+  IndexErase(name_index_, game_object->name_id_, game_object, &engine::object::GameObject::name_index_slot_);
+  IndexErase(tag_index_, game_object->tag_id_, game_object, &engine::object::GameObject::tag_index_slot_);
+  // 放在 Clean 之后判断：清理精灵组件会把对象改回不可剔除
+  if (!game_object->is_cullable_) {
+    UnculledErase(game_object);
+  }
+  game_objects_[index].reset();
+  ++removed_count_;
+}
+
+void Scene::CompactGameObjects() {
+  // 稳定压缩：一次遍历挤掉所有空位，并更新下标
+  size_t write = 0;
+  for (size_t read = 0; read < game_objects_.size(); ++read) {
+    if (!game_objects_[read]) {
+      continue;
+    }
+    if (write != read) {
+      game_objects_[write] = std::move(game_objects_[read]);
+    }
+    game_objects_[write]->scene_index_ = static_cast<uint32_t>(write);
+    ++write;
+  }
+  game_objects_.resize(write);
+  removed_count_ = 0;
+}
+
+engine::object::GameObjectHandle Scene::AcquireHandle(engine::object::GameObject* game_object) {
+  uint32_t index = 0;
+  if (!free_handle_slots_.empty()) {
+    index = free_handle_slots_.back();
+    free_handle_slots_.pop_back();
+  } else {
+    index = static_cast<uint32_t>(handle_slots_.size());
+    handle_slots_.emplace_back();
+  }
+  handle_slots_[index].object = game_object;
+  return {index, handle_slots_[index].generation};
+}
+
+void Scene::ReleaseHandle(engine::object::GameObjectHandle handle) {
+  if (GetGameObject(handle) == nullptr) {
+    return;
+  }
+  auto& slot = handle_slots_[handle.index];
+  slot.object = nullptr;
+  ++slot.generation;
+  free_handle_slots_.push_back(handle.index);
+}
+
+void Scene::OnGameObjectNameChanged(engine::object::GameObject* game_object, engine::utils::StringId old_name) {
+  IndexErase(name_index_, old_name, game_object, &engine::object::GameObject::name_index_slot_);
+  IndexInsert(name_index_, game_object->name_id_, game_object, &engine::object::GameObject::name_index_slot_);
+}
+
+void Scene::OnGameObjectTagChanged(engine::object::GameObject* game_object, engine::utils::StringId old_tag) {
+  IndexErase(tag_index_, old_tag, game_object, &engine::object::GameObject::tag_index_slot_);
+  IndexInsert(tag_index_, game_object->tag_id_, game_object, &engine::object::GameObject::tag_index_slot_);
+}
+
+void Scene::OnGameObjectCullableChanged(engine::object::GameObject* game_object) {
+  if (game_object->is_cullable_) {
+    UnculledErase(game_object);
+  } else {
+    UnculledInsert(game_object);
+  }
+}
+
+void Scene::UnculledInsert(engine::object::GameObject* game_object) {
+  game_object->unculled_slot_ = static_cast<uint32_t>(unculled_objects_.size());
+  unculled_objects_.push_back(game_object);
+}
+
+void Scene::UnculledErase(engine::object::GameObject* game_object) {
+  const uint32_t position = game_object->unculled_slot_;
+  if (position >= unculled_objects_.size() || unculled_objects_[position] != game_object) {
+    LOGW(TAG, "unculled list out of sync for game object {}", game_object->GetName());
+    return;
+  }
+  // 顺序在 Render 里按对象数组下标重排，这里直接与末尾交换删除
+  unculled_objects_[position] = unculled_objects_.back();
+  unculled_objects_[position]->unculled_slot_ = position;
+  unculled_objects_.pop_back();
+}
+
+engine::utils::Rect Scene::GetVisibleArea() const {
+  const auto& camera = context_.GetCamera();
+  return {camera.GetPosition() - glm::vec2(kCullingMargin),
+          camera.GetViewportSize() + glm::vec2(kCullingMargin * 2.0f)};
+}
+
+void Scene::IndexInsert(StringIndex& index, engine::utils::StringId key, engine::object::GameObject* game_object,
+                        uint32_t engine::object::GameObject::*slot) {
+  // 空名字/空标签不建索引，否则大量未命名对象会挤在同一个桶里
+  if (key.IsEmpty()) {
+    return;
+  }
+  auto& bucket = index[key];
+  game_object->*slot = static_cast<uint32_t>(bucket.size());
+  bucket.push_back(game_object);
+}
+
+void Scene::IndexErase(StringIndex& index, engine::utils::StringId key, engine::object::GameObject* game_object,
+                       uint32_t engine::object::GameObject::*slot) {
+  if (key.IsEmpty()) {
+    return;
+  }
+  const auto it = index.find(key);
+  if (it == index.end()) {
+    return;
+  }
+  auto& bucket = it->second;
+  const uint32_t position = game_object->*slot;
+  if (position >= bucket.size() || bucket[position] != game_object) {
+    LOGW(TAG, "scene index out of sync for game object {}", game_object->GetName());
+    return;
+  }
+  bucket[position] = bucket.back();
+  bucket[position]->*slot = position;
+  bucket.pop_back();
+  // 空桶保留，标签反复出现/消失时不必重新分配
 }
 
 void Scene::ProcessPendingAdditions() {
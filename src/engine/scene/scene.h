@@ -1,7 +1,13 @@
 #pragma once
+#include <functional>
 #include <memory>
+#include <span>
 #include <string>
+#include <unordered_map>
 #include <vector>
+#include "object/game_object_handle.h"
+#include "spatial_grid.h"
+#include "utils/string_id.h"
 
 namespace engine::core {
 class Context;
@@ -20,10 +26,16 @@ namespace engine::object {
 class GameObject;
 }
 
+namespace engine::resource {
+struct PreloadSet;
+}  // namespace engine::resource
+
 namespace engine::scene {
 class SceneManager;
 
 class Scene {
+  friend class engine::object::GameObject;
+
  public:
   explicit Scene(std::string name, engine::core::Context& context, engine::scene::SceneManager& scene_manager);
 
@@ -40,6 +52,10 @@ class Scene {
   virtual void Render();
   virtual void HandleInput();
   virtual void Clean();
+  // 进入场景前需要预加载的资源。返回的函数在加载线程上生成资源清单（可以读文件、解析关卡），
+  // 不能访问场景对象；SceneManager 会等清单中的资源在后台加载完成后才切换场景，避免切换时卡顿。
+  // 返回空函数表示没有需要预加载的资源
+  [[nodiscard]] virtual std::function<engine::resource::PreloadSet()> GetPreloadCollector() const;
 
   virtual void AddGameObject(std::unique_ptr<engine::object::GameObject>&& game_object);
 
@@ -47,13 +63,23 @@ class Scene {
 
   virtual void RemoveGameObject(engine::object::GameObject* game_object_ptr);
 
+  // 标记移除，本帧 Update 末尾统一清理；GameObject::SetNeedRemove(true) 等价于调用它
   virtual void SafeRemoveGameObject(engine::object::GameObject* game_object_ptr);
 
+  // 解析句柄，对象已被移除时返回 nullptr
+  [[nodiscard]] engine::object::GameObject* GetGameObject(engine::object::GameObjectHandle handle) const;
+
+  // 按添加顺序排列；已移除但尚未压缩的位置为 nullptr，遍历时需要判空
   [[nodiscard]] const std::vector<std::unique_ptr<engine::object::GameObject>>& GetGameObjects() const {
     return game_objects_;
   }
 
+  // 名字/标签查找走哈希索引，O(1)。同名对象有多个时返回其中任意一个
   [[nodiscard]] engine::object::GameObject* FindGameObjectByName(const std::string& name) const;
+  [[nodiscard]] engine::object::GameObject* FindGameObjectByName(engine::utils::StringId name) const;
+  // 返回索引内部数组的视图，不分配内存；顺序不固定，场景增删对象或改标签后失效
+  [[nodiscard]] std::span<engine::object::GameObject* const> FindGameObjectsByTag(const std::string& tag) const;
+  [[nodiscard]] std::span<engine::object::GameObject* const> FindGameObjectsByTag(engine::utils::StringId tag) const;
 
   void SetName(const std::string& name) {
     scene_name_ = name;
@@ -78,16 +104,67 @@ class Scene {
     return game_objects_;
   }
 
+  // 带 TransformComponent 的对象按世界包围盒登记在这里，用于范围查询和碰撞对生成
+  [[nodiscard]] SpatialGrid& GetSpatialGrid() {
+    return spatial_grid_;
+  }
+  [[nodiscard]] const SpatialGrid& GetSpatialGrid() const {
+    return spatial_grid_;
+  }
+
  protected:
   void ProcessPendingAdditions();
+  // 清理本帧登记的待移除对象，空位足够多时压缩对象数组
+  void RemovePendingGameObjects();
+
+ private:
+  using IndexBucket = std::vector<engine::object::GameObject*>;
+  using StringIndex = std::unordered_map<engine::utils::StringId, IndexBucket>;
+
+  void DestroyGameObject(engine::object::GameObject* game_object);
+  void CompactGameObjects();
+  engine::object::GameObjectHandle AcquireHandle(engine::object::GameObject* game_object);
+  void ReleaseHandle(engine::object::GameObjectHandle handle);
+
+  // 由 GameObject::SetName/SetTag 调用
+  void OnGameObjectNameChanged(engine::object::GameObject* game_object, engine::utils::StringId old_name);
+  void OnGameObjectTagChanged(engine::object::GameObject* game_object, engine::utils::StringId old_tag);
+  void OnGameObjectCullableChanged(engine::object::GameObject* game_object);
+  void UnculledInsert(engine::object::GameObject* game_object);
+  void UnculledErase(engine::object::GameObject* game_object);
+  // 相机视口对应的世界矩形，四周留出余量
+  [[nodiscard]] engine::utils::Rect GetVisibleArea() const;
+  // slot 指向对象上记录桶内位置的成员，删除时交换到末尾弹出，O(1)
+  static void IndexInsert(StringIndex& index, engine::utils::StringId key, engine::object::GameObject* game_object,
+                          uint32_t engine::object::GameObject::*slot);
+  static void IndexErase(StringIndex& index, engine::utils::StringId key, engine::object::GameObject* game_object,
+                         uint32_t engine::object::GameObject::*slot);
 
  protected:
   std::string scene_name_;
   engine::core::Context& context_;
   engine::scene::SceneManager& scene_manager_;
   bool is_initialized_{false};
+  // 声明在对象数组之前：场景析构时对象的变换组件要先从索引中注销
+  SpatialGrid spatial_grid_;
   std::vector<std::unique_ptr<engine::object::GameObject>> game_objects_;
   std::vector<std::unique_ptr<engine::object::GameObject>> pending_additions_;
+  // 存句柄而不是指针：登记后对象可能已被 RemoveGameObject 立即销毁
+  std::vector<engine::object::GameObjectHandle> pending_removals_;
+  size_t removed_count_ = 0;  // game_objects_ 中的空位数
+
+ private:
+  struct HandleSlot {
+    engine::object::GameObject* object = nullptr;
+    uint32_t generation = 0;
+  };
+  std::vector<HandleSlot> handle_slots_;
+  std::vector<uint32_t> free_handle_slots_;
+  StringIndex name_index_;
+  StringIndex tag_index_;
+  // 不可剔除的对象（瓦片层、视差背景等）每帧都渲染；可剔除对象每帧从空间索引中查询
+  std::vector<engine::object::GameObject*> unculled_objects_;
+  std::vector<engine::object::GameObject*> render_list_;  // 本帧要渲染的对象，复用以免每帧分配
 };
 
 }  // namespace engine::scene
\ No newline at end of file
@@ -1,7 +1,10 @@
 #include "scene_manager.h"
 #include <logger.hpp>
 #include "core/context.h"
+#include "render/renderer.h"
+#include "resource/resource_manager.h"
 #include "scene.h"
+#include "utils/profiler.h"
 
 namespace engine::scene {
 namespace {
@@ -25,17 +28,23 @@ Scene* SceneManager::GetCurrentScene() const {
 }
 
 void SceneManager::Update(double delta_time_s) {
+  PROFILE_SCOPE("SceneManager::Update");
   if (Scene* current_scene = GetCurrentScene()) {
     current_scene->Update(delta_time_s);
   }
 
-  ProcessPendingActions();
+  if (!is_pending_actions_deferred_) {
+    ProcessPendingActions();
+  }
 }
 
 void SceneManager::Render() {
+  PROFILE_SCOPE("SceneManager::Render");
   for (const auto& scene : scene_stack_) {
     if (scene) {
       scene->Render();
+      // 每个场景单独提交，保证场景栈的上下层关系不被渲染队列的排序打乱
+      context_.GetRenderer().FlushSprites();
     }
   }
 }
@@ -59,20 +68,45 @@ void SceneManager::Close() {
 
 void SceneManager::RequestPopScene() {
   pending_action_ = PendingAction::Pop;
+  pending_scene_.reset();
+  PreloadPendingScene();
 }
 
 void SceneManager::RequestReplaceScene(std::unique_ptr<Scene>&& scene) {
   pending_action_ = PendingAction::Replace;
   pending_scene_ = std::move(scene);
+  PreloadPendingScene();
 }
 
 void SceneManager::RequestPushScene(std::unique_ptr<Scene>&& scene) {
   pending_action_ = PendingAction::Push;
   pending_scene_ = std::move(scene);
+  PreloadPendingScene();
+}
+
+void SceneManager::PreloadPendingScene() {
+  const uint32_t token = ++preload_token_;
+  is_pending_scene_ready_ = true;
+  if (!pending_scene_) {
+    return;
+  }
+  auto collector = pending_scene_->GetPreloadCollector();
+  if (!collector) {
+    return;
+  }
+
+  // 旧场景继续更新和渲染，资源清单在加载线程上生成，资源在后台解码、逐帧上传，全部就绪后再切换
+  is_pending_scene_ready_ = false;
+  LOGD(TAG, "preloading assets for scene '{}' ...", pending_scene_->GetName());
+  context_.GetResourceManager().PreloadAsync(std::move(collector), nullptr, [this, token]() {
+    if (token == preload_token_) {
+      is_pending_scene_ready_ = true;
+    }
+  });
 }
 
 void SceneManager::ProcessPendingActions() {
-  if (pending_action_ == PendingAction::None) {
+  if (pending_action_ == PendingAction::None || !is_pending_scene_ready_) {
     return;
   }
 
@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -38,9 +39,16 @@ class SceneManager final {
   void HandleInput() const;
   void Close();
 
- private:
+  // 场景 Init/Clean 会加载资源、创建纹理，流水线模式下要推迟到主线程的帧间同步点，由调用方执行 ProcessPendingActions
+  void SetDeferPendingActions(bool defer) {
+    is_pending_actions_deferred_ = defer;
+  }
   void ProcessPendingActions();
 
+ private:
+  // 为待切换的场景发起后台预加载，完成前 ProcessPendingActions 不会执行 Push/Replace
+  void PreloadPendingScene();
+
   void PushScene(std::unique_ptr<Scene>&& scene);
   void PopScene();
   void ReplaceScene(std::unique_ptr<Scene>&& scene);
@@ -52,6 +60,9 @@ class SceneManager final {
   enum class PendingAction { None, Push, Pop, Replace };
   PendingAction pending_action_ = PendingAction::None;
   std::unique_ptr<Scene> pending_scene_;
+  bool is_pending_scene_ready_ = true;
+  uint32_t preload_token_ = 0;  // 每次发起新请求时递增，过期的完成回调据此忽略
+  bool is_pending_actions_deferred_ = false;
 };
 
 }  // namespace engine::scene
\ No newline at end of file
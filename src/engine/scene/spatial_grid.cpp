@@ -0,0 +1,140 @@
+#include "spatial_grid.h"
+#include "logger.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace engine::scene {
+namespace {
+DECLARE_TAG(SpatialGrid)
+}  // namespace
+
+SpatialGrid::SpatialGrid(float cell_size) : cell_size_(cell_size), inverse_cell_size_(0.0f) {
+  if (!(cell_size_ > 0.0f)) {
+    throw std::invalid_argument("SpatialGrid cell size must be positive");
+  }
+  inverse_cell_size_ = 1.0f / cell_size_;
+}
+
+uint32_t SpatialGrid::Insert(engine::object::GameObject* game_object, const engine::utils::Rect& bounds) {
+  uint32_t proxy = 0;
+  if (!free_proxies_.empty()) {
+    proxy = free_proxies_.back();
+    free_proxies_.pop_back();
+  } else {
+    proxy = static_cast<uint32_t>(proxies_.size());
+    proxies_.emplace_back();
+    query_stamps_.push_back(0);
+  }
+  auto& entry = proxies_[proxy];
+  entry.game_object = game_object;
+  entry.bounds = bounds;
+  entry.cells = GetCellRange(bounds);
+  entry.is_used = true;
+  AddToCells(proxy, entry.cells);
+  return proxy;
+}
+
+void SpatialGrid::Update(uint32_t proxy, const engine::utils::Rect& bounds) {
+  if (proxy >= proxies_.size() || !proxies_[proxy].is_used) {
+    LOGW(TAG, "Update with invalid proxy {}", proxy);
+    return;
+  }
+  auto& entry = proxies_[proxy];
+  entry.bounds = bounds;
+  const CellRange cells = GetCellRange(bounds);
+  // 大多数帧里对象只在格子内移动，格子范围不变就不碰格子表
+  if (cells == entry.cells) {
+    return;
+  }
+  RemoveFromCells(proxy, entry.cells);
+  AddToCells(proxy, cells);
+  entry.cells = cells;
+}
+
+void SpatialGrid::Remove(uint32_t proxy) {
+  if (proxy >= proxies_.size() || !proxies_[proxy].is_used) {
+    LOGW(TAG, "Remove with invalid proxy {}", proxy);
+    return;
+  }
+  RemoveFromCells(proxy, proxies_[proxy].cells);
+  proxies_[proxy] = Proxy{};
+  free_proxies_.push_back(proxy);
+}
+
+void SpatialGrid::Clear() {
+  proxies_.clear();
+  free_proxies_.clear();
+  cells_.clear();
+  query_stamps_.clear();
+  query_stamp_ = 0;
+}
+
+void SpatialGrid::Query(const engine::utils::Rect& area, std::vector<engine::object::GameObject*>& result) const {
+  if (++query_stamp_ == 0) {
+    // 计数回绕时清空旧标记，避免把很久以前的查询当成本次
+    std::fill(query_stamps_.begin(), query_stamps_.end(), 0);
+    query_stamp_ = 1;
+  }
+  const CellRange cells = GetCellRange(area);
+  for (int32_t y = cells.min_y; y <= cells.max_y; ++y) {
+    for (int32_t x = cells.min_x; x <= cells.max_x; ++x) {
+      const auto it = cells_.find(PackCellKey(x, y));
+      if (it == cells_.end()) {
+        continue;
+      }
+      for (const uint32_t proxy : it->second) {
+        if (query_stamps_[proxy] == query_stamp_) {
+          continue;
+        }
+        query_stamps_[proxy] = query_stamp_;
+        const auto& entry = proxies_[proxy];
+        if (Overlaps(entry.bounds, area)) {
+          result.push_back(entry.game_object);
+        }
+      }
+    }
+  }
+}
+
+SpatialGrid::CellRange SpatialGrid::GetCellRange(const engine::utils::Rect& bounds) const {
+  const glm::vec2 min = bounds.position;
+  const glm::vec2 max = bounds.position + glm::max(bounds.size, glm::vec2(0.0f));
+  return {static_cast<int32_t>(std::floor(min.x * inverse_cell_size_)),
+          static_cast<int32_t>(std::floor(min.y * inverse_cell_size_)),
+          static_cast<int32_t>(std::floor(max.x * inverse_cell_size_)),
+          static_cast<int32_t>(std::floor(max.y * inverse_cell_size_))};
+}
+
+void SpatialGrid::AddToCells(uint32_t proxy, const CellRange& cells) {
+  for (int32_t y = cells.min_y; y <= cells.max_y; ++y) {
+    for (int32_t x = cells.min_x; x <= cells.max_x; ++x) {
+      cells_[PackCellKey(x, y)].push_back(proxy);
+    }
+  }
+}
+
+void SpatialGrid::RemoveFromCells(uint32_t proxy, const CellRange& cells) {
+  for (int32_t y = cells.min_y; y <= cells.max_y; ++y) {
+    for (int32_t x = cells.min_x; x <= cells.max_x; ++x) {
+      const auto it = cells_.find(PackCellKey(x, y));
+      if (it == cells_.end()) {
+        continue;
+      }
+      // 每格的代理数很少，线性查找后与末尾交换删除
+      auto& bucket = it->second;
+      const auto position = std::find(bucket.begin(), bucket.end(), proxy);
+      if (position != bucket.end()) {
+        *position = bucket.back();
+        bucket.pop_back();
+      }
+    }
+  }
+}
+
+bool SpatialGrid::Overlaps(const engine::utils::Rect& a, const engine::utils::Rect& b) {
+  return a.position.x <= b.position.x + b.size.x && b.position.x <= a.position.x + a.size.x &&
+         a.position.y <= b.position.y + b.size.y && b.position.y <= a.position.y + a.size.y;
+}
+
+}  // namespace engine::scene
@@ -0,0 +1,113 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+#include "utils/math.hpp"
+
+namespace engine::object {
+class GameObject;
+}  // namespace engine::object
+
+namespace engine::scene {
+
+/**
+ * @brief 场景对象的均匀网格空间索引（broadphase）。
+ * 每个代理记录一个对象的世界包围盒，登记在它覆盖的所有格子里；包围盒移动但没有跨格时只更新代理本身。
+ * 格子用哈希表按需创建，地图大小不需要预先知道，负坐标也可以。
+ * 由 TransformComponent 在位置变化时增量更新。非线程安全，只在主线程使用（包括 const 的查询）。
+ */
+class SpatialGrid final {
+ public:
+  static constexpr uint32_t kInvalidProxy = std::numeric_limits<uint32_t>::max();
+
+  // cell_size 取场景中常见对象尺寸的几倍：太小则大对象跨很多格，太大则每格对象太多
+  explicit SpatialGrid(float cell_size = 64.0f);
+
+  // 禁止拷贝和移动
+  SpatialGrid(const SpatialGrid&) = delete;
+  SpatialGrid& operator=(const SpatialGrid&) = delete;
+  SpatialGrid(SpatialGrid&&) = delete;
+  SpatialGrid& operator=(SpatialGrid&&) = delete;
+
+  uint32_t Insert(engine::object::GameObject* game_object, const engine::utils::Rect& bounds);
+  void Update(uint32_t proxy, const engine::utils::Rect& bounds);
+  void Remove(uint32_t proxy);
+  void Clear();
+
+  // 把包围盒与 area 相交（含边界接触）的对象追加到 result，每个对象只出现一次，顺序不固定
+  void Query(const engine::utils::Rect& area, std::vector<engine::object::GameObject*>& result) const;
+
+  // 对每一对包围盒相交的对象调用 fn(a, b)，每对只调用一次
+  template <typename Fn>
+  void ForEachPair(Fn&& fn) const {
+    for (const auto& [key, bucket] : cells_) {
+      const CellCoord cell = UnpackCellKey(key);
+      for (size_t i = 0; i < bucket.size(); ++i) {
+        const Proxy& a = proxies_[bucket[i]];
+        for (size_t j = i + 1; j < bucket.size(); ++j) {
+          const Proxy& b = proxies_[bucket[j]];
+          // 两个对象可能同时出现在多个格子里，只在它们共同覆盖区域的左上角格子里报告
+          const bool is_first_shared_cell =
+              cell.x == std::max(a.cells.min_x, b.cells.min_x) && cell.y == std::max(a.cells.min_y, b.cells.min_y);
+          if (is_first_shared_cell && Overlaps(a.bounds, b.bounds)) {
+            fn(a.game_object, b.game_object);
+          }
+        }
+      }
+    }
+  }
+
+  [[nodiscard]] float GetCellSize() const {
+    return cell_size_;
+  }
+  [[nodiscard]] size_t GetProxyCount() const {
+    return proxies_.size() - free_proxies_.size();
+  }
+
+ private:
+  struct CellCoord {
+    int32_t x = 0;
+    int32_t y = 0;
+  };
+  // 包围盒覆盖的格子范围，闭区间
+  struct CellRange {
+    int32_t min_x = 0;
+    int32_t min_y = 0;
+    int32_t max_x = -1;
+    int32_t max_y = -1;
+
+    bool operator==(const CellRange&) const = default;
+  };
+  struct Proxy {
+    engine::object::GameObject* game_object = nullptr;
+    engine::utils::Rect bounds{};
+    CellRange cells;
+    bool is_used = false;
+  };
+
+  [[nodiscard]] CellRange GetCellRange(const engine::utils::Rect& bounds) const;
+  void AddToCells(uint32_t proxy, const CellRange& cells);
+  void RemoveFromCells(uint32_t proxy, const CellRange& cells);
+  static bool Overlaps(const engine::utils::Rect& a, const engine::utils::Rect& b);
+
+  static uint64_t PackCellKey(int32_t x, int32_t y) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+  }
+  static CellCoord UnpackCellKey(uint64_t key) {
+    return {static_cast<int32_t>(static_cast<uint32_t>(key >> 32)), static_cast<int32_t>(static_cast<uint32_t>(key))};
+  }
+
+  float cell_size_;
+  float inverse_cell_size_;
+  std::vector<Proxy> proxies_;
+  std::vector<uint32_t> free_proxies_;
+  // 格子 -> 代理列表。空格子保留，对象来回移动时不必反复分配
+  std::unordered_map<uint64_t, std::vector<uint32_t>> cells_;
+  // 查询去重：跨多个格子的代理在一次查询中只收录一次，记录每个代理最近被哪次查询收录
+  mutable std::vector<uint32_t> query_stamps_;
+  mutable uint32_t query_stamp_ = 0;
+};
+
+}  // namespace engine::scene
@@ -0,0 +1,168 @@
+#include "allocation_counter.h"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#ifdef _MSC_VER
+#include <malloc.h>
+#endif
+
+namespace engine::utils {
+namespace {
+std::atomic<uint64_t> allocation_count{0};
+std::atomic<uint64_t> allocated_bytes{0};
+}  // namespace
+
+uint64_t AllocationCounter::GetCount() {
+  return allocation_count.load(std::memory_order_relaxed);
+}
+
+uint64_t AllocationCounter::GetBytes() {
+  return allocated_bytes.load(std::memory_order_relaxed);
+}
+
+bool AllocationCounter::IsEnabled() {
+#ifdef SUNNYLAND_DISABLE_ALLOCATION_COUNTER
+  return false;
+#else
+  return true;
+#endif
+}
+
+}  // namespace engine::utils
+
+#ifndef SUNNYLAND_DISABLE_ALLOCATION_COUNTER
+namespace {
+void CountAllocation(std::size_t size) {
+  engine::utils::allocation_count.fetch_add(1, std::memory_order_relaxed);
+  engine::utils::allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+// 与标准 operator new 的语义一致：失败时调用 new_handler 重试，没有 handler 时抛出 bad_alloc
+void* CountedAllocate(std::size_t size) {
+  CountAllocation(size);
+  if (size == 0) {
+    size = 1;
+  }
+  while (true) {
+    if (void* ptr = std::malloc(size)) {
+      return ptr;
+    }
+    const std::new_handler handler = std::get_new_handler();
+    if (handler == nullptr) {
+      throw std::bad_alloc();
+    }
+    handler();
+  }
+}
+
+void* CountedAllocateAligned(std::size_t size, std::align_val_t align) {
+  CountAllocation(size);
+  const auto alignment = static_cast<std::size_t>(align);
+  // aligned_alloc 要求大小是对齐值的整数倍
+  size = (std::max<std::size_t>(size, 1) + alignment - 1) & ~(alignment - 1);
+  while (true) {
+#ifdef _MSC_VER
+    void* ptr = _aligned_malloc(size, alignment);
+#else
+    void* ptr = std::aligned_alloc(alignment, size);
+#endif
+    if (ptr != nullptr) {
+      return ptr;
+    }
+    const std::new_handler handler = std::get_new_handler();
+    if (handler == nullptr) {
+      throw std::bad_alloc();
+    }
+    handler();
+  }
+}
+
+void FreeAligned(void* ptr) {
+#ifdef _MSC_VER
+  _aligned_free(ptr);
+#else
+  std::free(ptr);
+#endif
+}
+}  // namespace
+
+void* operator new(std::size_t size) {
+  return CountedAllocate(size);
+}
+void* operator new[](std::size_t size) {
+  return CountedAllocate(size);
+}
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+  try {
+    return CountedAllocate(size);
+  } catch (...) {
+    return nullptr;
+  }
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+  try {
+    return CountedAllocate(size);
+  } catch (...) {
+    return nullptr;
+  }
+}
+void* operator new(std::size_t size, std::align_val_t align) {
+  return CountedAllocateAligned(size, align);
+}
+void* operator new[](std::size_t size, std::align_val_t align) {
+  return CountedAllocateAligned(size, align);
+}
+void* operator new(std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+  try {
+    return CountedAllocateAligned(size, align);
+  } catch (...) {
+    return nullptr;
+  }
+}
+void* operator new[](std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+  try {
+    return CountedAllocateAligned(size, align);
+  } catch (...) {
+    return nullptr;
+  }
+}
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+void operator delete[](void* ptr) noexcept {
+  std::free(ptr);
+}
+void operator delete(void* ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+void operator delete[](void* ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+  std::free(ptr);
+}
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+  std::free(ptr);
+}
+void operator delete(void* ptr, std::align_val_t) noexcept {
+  FreeAligned(ptr);
+}
+void operator delete[](void* ptr, std::align_val_t) noexcept {
+  FreeAligned(ptr);
+}
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept {
+  FreeAligned(ptr);
+}
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept {
+  FreeAligned(ptr);
+}
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept {
+  FreeAligned(ptr);
+}
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept {
+  FreeAligned(ptr);
+}
+#endif
@@ -0,0 +1,19 @@
+#pragma once
+#include <cstdint>
+
+namespace engine::utils {
+
+/**
+ * @brief 全局堆分配计数。
+ * 由 allocation_counter.cpp 替换全局 operator new/delete 实现，每次分配只多一次原子加法。
+ * 构建时定义 SUNNYLAND_DISABLE_ALLOCATION_COUNTER 则不替换，计数恒为 0。
+ */
+class AllocationCounter final {
+ public:
+  // 程序启动以来的累计值，取两次之差得到一段代码内的分配次数
+  [[nodiscard]] static uint64_t GetCount();
+  [[nodiscard]] static uint64_t GetBytes();
+  [[nodiscard]] static bool IsEnabled();
+};
+
+}  // namespace engine::utils
@@ -0,0 +1,144 @@
+#include "async_log_sink.h"
+#include <spdlog/details/log_msg.h>
+#include <spdlog/formatter.h>
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <format>
+
+namespace engine::utils {
+namespace {
+// 队列空时后台线程的轮询间隔，远小于一帧，且不需要生产者做任何唤醒
+constexpr auto kIdleSleep = std::chrono::milliseconds(1);
+}  // namespace
+
+AsyncLogSink::AsyncLogSink(std::vector<spdlog::sink_ptr> targets, size_t capacity)
+    : targets_(std::move(targets)) {
+  capacity = std::bit_ceil(std::max<size_t>(capacity, 2));
+  slots_ = std::make_unique<Slot[]>(capacity);
+  mask_ = capacity - 1;
+  for (size_t i = 0; i < capacity; ++i) {
+    slots_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+  consumer_ = std::thread(&AsyncLogSink::ConsumerLoop, this);
+}
+
+AsyncLogSink::~AsyncLogSink() {
+  is_stopping_.store(true, std::memory_order_release);
+  if (consumer_.joinable()) {
+    consumer_.join();
+  }
+}
+
+void AsyncLogSink::log(const spdlog::details::log_msg& msg) {
+  if (!TryPush(msg)) {
+    dropped_count_.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+void AsyncLogSink::flush() {
+  const size_t target = enqueue_pos_.load(std::memory_order_acquire);
+  while (written_pos_.load(std::memory_order_acquire) < target && consumer_.joinable()) {
+    std::this_thread::sleep_for(kIdleSleep);
+  }
+}
+
+void AsyncLogSink::set_pattern(const std::string& pattern) {
+  for (auto& target : targets_) {
+    target->set_pattern(pattern);
+  }
+}
+
+void AsyncLogSink::set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter) {
+  for (auto& target : targets_) {
+    target->set_formatter(sink_formatter->clone());
+  }
+}
+
+bool AsyncLogSink::TryPush(const spdlog::details::log_msg& msg) {
+  size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+  Slot* slot = nullptr;
+  while (true) {
+    slot = &slots_[pos & mask_];
+    const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+    const auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+    if (diff == 0) {
+      if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      return false;  // 队列已满
+    } else {
+      pos = enqueue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+
+  auto& record = slot->record;
+  record.level = msg.level;
+  record.time = msg.time;
+  record.thread_id = msg.thread_id;
+  record.logger_name.assign(msg.logger_name.data(), msg.logger_name.size());
+  record.payload.assign(msg.payload.data(), msg.payload.size());
+  slot->sequence.store(pos + 1, std::memory_order_release);
+  return true;
+}
+
+bool AsyncLogSink::TryPop(Record& record) {
+  const size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+  Slot& slot = slots_[pos & mask_];
+  if (slot.sequence.load(std::memory_order_acquire) != pos + 1) {
+    return false;
+  }
+  // 交换而不是拷贝：槽位拿回上一条记录的字符串缓冲，下次写入时通常无需分配
+  std::swap(record, slot.record);
+  slot.sequence.store(pos + mask_ + 1, std::memory_order_release);
+  dequeue_pos_.store(pos + 1, std::memory_order_release);
+  return true;
+}
+
+void AsyncLogSink::ConsumerLoop() {
+  Record record;
+  while (true) {
+    bool has_written = false;
+    while (TryPop(record)) {
+      WriteRecord(record);
+      has_written = true;
+    }
+    ReportDropped();
+    if (has_written) {
+      for (auto& target : targets_) {
+        target->flush();
+      }
+      written_pos_.store(dequeue_pos_.load(std::memory_order_relaxed), std::memory_order_release);
+      continue;
+    }
+    // 先确认队列已空再退出，析构前入队的消息不会丢
+    if (is_stopping_.load(std::memory_order_acquire)) {
+      return;
+    }
+    std::this_thread::sleep_for(kIdleSleep);
+  }
+}
+
+void AsyncLogSink::WriteRecord(const Record& record) {
+  spdlog::details::log_msg msg(record.time, spdlog::source_loc{}, record.logger_name, record.level, record.payload);
+  msg.thread_id = record.thread_id;
+  for (auto& target : targets_) {
+    if (target->should_log(msg.level)) {
+      target->log(msg);
+    }
+  }
+}
+
+void AsyncLogSink::ReportDropped() {
+  const uint64_t dropped = dropped_count_.load(std::memory_order_relaxed);
+  if (dropped == reported_dropped_) {
+    return;
+  }
+  const std::string text =
+      std::format("[AsyncLogSink] log queue full, dropped {} message(s)", dropped - reported_dropped_);
+  reported_dropped_ = dropped;
+  WriteRecord({spdlog::level::warn, spdlog::log_clock::now(), 0, {}, text});
+}
+
+}  // namespace engine::utils
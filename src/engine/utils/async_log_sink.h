@@ -0,0 +1,77 @@
+#pragma once
+#include <spdlog/common.h>
+#include <spdlog/sinks/sink.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace engine::utils {
+
+/**
+ * @brief 异步日志 sink。
+ * 调用线程只把级别、时间、线程 id 和消息正文拷进一个有界无锁 MPSC 环形队列，格式化和 I/O 都在后台线程完成，
+ * 后台线程再把消息转交给真正的输出 sink（控制台、文件等）。
+ * 队列满时直接丢弃并计数，绝不阻塞游戏线程；丢弃数量由后台线程定期补记一条警告。
+ */
+class AsyncLogSink final : public spdlog::sinks::sink {
+ public:
+  static constexpr size_t kDefaultCapacity = 8192;
+
+  // capacity 会向上取到 2 的幂
+  explicit AsyncLogSink(std::vector<spdlog::sink_ptr> targets, size_t capacity = kDefaultCapacity);
+  ~AsyncLogSink() override;
+
+  // 禁止拷贝和移动
+  AsyncLogSink(const AsyncLogSink&) = delete;
+  AsyncLogSink& operator=(const AsyncLogSink&) = delete;
+  AsyncLogSink(AsyncLogSink&&) = delete;
+  AsyncLogSink& operator=(AsyncLogSink&&) = delete;
+
+  void log(const spdlog::details::log_msg& msg) override;
+  // 等待调用时刻之前入队的消息全部写出
+  void flush() override;
+  void set_pattern(const std::string& pattern) override;
+  void set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter) override;
+
+  [[nodiscard]] uint64_t GetDroppedCount() const {
+    return dropped_count_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  struct Record {
+    spdlog::level::level_enum level = spdlog::level::off;
+    spdlog::log_clock::time_point time;
+    size_t thread_id = 0;
+    std::string logger_name;
+    std::string payload;  // 槽位复用，容量够时不再分配
+  };
+  // 每个槽位带序号：等于 pos 表示可写，等于 pos + 1 表示已写好可读（Vyukov 有界队列）
+  struct Slot {
+    std::atomic<size_t> sequence{0};
+    Record record;
+  };
+
+  bool TryPush(const spdlog::details::log_msg& msg);
+  bool TryPop(Record& record);
+  void ConsumerLoop();
+  void WriteRecord(const Record& record);
+  void ReportDropped();
+
+  std::vector<spdlog::sink_ptr> targets_;
+  std::unique_ptr<Slot[]> slots_;
+  size_t mask_ = 0;
+
+  alignas(64) std::atomic<size_t> enqueue_pos_{0};
+  alignas(64) std::atomic<size_t> dequeue_pos_{0};  // 只有后台线程写
+  std::atomic<size_t> written_pos_{0};              // 已经写出并 flush 到目标 sink 的位置
+  std::atomic<uint64_t> dropped_count_{0};
+  uint64_t reported_dropped_ = 0;
+  std::atomic<bool> is_stopping_{false};
+  std::thread consumer_;
+};
+
+}  // namespace engine::utils
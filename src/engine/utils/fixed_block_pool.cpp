@@ -0,0 +1,101 @@
+#include "fixed_block_pool.h"
+
+#include <algorithm>
+#include <cassert>
+#include <new>
+#include <stdexcept>
+
+namespace engine::utils {
+namespace {
+#ifndef NDEBUG
+// 调试构建下标记池正被使用，另一个线程同时进入时断言失败
+class ExclusiveUseCheck final {
+ public:
+  explicit ExclusiveUseCheck(std::atomic<bool>& is_in_use) : is_in_use_(is_in_use) {
+    [[maybe_unused]] const bool was_in_use = is_in_use_.exchange(true, std::memory_order_acquire);
+    assert(!was_in_use && "FixedBlockPool used from two threads at the same time");
+  }
+  ~ExclusiveUseCheck() {
+    is_in_use_.store(false, std::memory_order_release);
+  }
+  ExclusiveUseCheck(const ExclusiveUseCheck&) = delete;
+  ExclusiveUseCheck& operator=(const ExclusiveUseCheck&) = delete;
+  ExclusiveUseCheck(ExclusiveUseCheck&&) = delete;
+  ExclusiveUseCheck& operator=(ExclusiveUseCheck&&) = delete;
+
+ private:
+  std::atomic<bool>& is_in_use_;
+};
+#define FIXED_BLOCK_POOL_CHECK_EXCLUSIVE() const ExclusiveUseCheck exclusive_use_check(is_in_use_)
+#else
+#define FIXED_BLOCK_POOL_CHECK_EXCLUSIVE() ((void)0)
+#endif
+}  // namespace
+
+FixedBlockPool::FixedBlockPool(size_t block_size, size_t block_align, size_t blocks_per_chunk)
+    : block_align_(std::max(block_align, alignof(FreeNode))), blocks_per_chunk_(blocks_per_chunk) {
+  if (block_size == 0 || blocks_per_chunk == 0) {
+    throw std::invalid_argument("FixedBlockPool block size and chunk size must be positive");
+  }
+  // 空闲时块内要放下链表节点，并且相邻块都满足对齐
+  block_size_ = std::max(block_size, sizeof(FreeNode));
+  block_size_ = (block_size_ + block_align_ - 1) / block_align_ * block_align_;
+}
+
+FixedBlockPool::~FixedBlockPool() {
+  ReleaseChunks();
+}
+
+void* FixedBlockPool::Allocate() {
+  FIXED_BLOCK_POOL_CHECK_EXCLUSIVE();
+  if (free_list_ == nullptr) {
+    AllocateChunk();
+  }
+  FreeNode* node = free_list_;
+  free_list_ = node->next;
+  ++live_count_;
+  return node;
+}
+
+void FixedBlockPool::Deallocate(void* block) {
+  if (block == nullptr) {
+    return;
+  }
+  FIXED_BLOCK_POOL_CHECK_EXCLUSIVE();
+  auto* node = static_cast<FreeNode*>(block);
+  node->next = free_list_;
+  free_list_ = node;
+  --live_count_;
+}
+
+bool FixedBlockPool::ReleaseIfUnused() {
+  FIXED_BLOCK_POOL_CHECK_EXCLUSIVE();
+  if (live_count_ != 0 || chunks_.empty()) {
+    return false;
+  }
+  ReleaseChunks();
+  return true;
+}
+
+void FixedBlockPool::AllocateChunk() {
+  auto* chunk =
+      static_cast<std::byte*>(::operator new(block_size_ * blocks_per_chunk_, std::align_val_t(block_align_)));
+  chunks_.push_back(chunk);
+  // 倒序压入，使分配顺序与内存地址顺序一致
+  for (size_t i = blocks_per_chunk_; i > 0; --i) {
+    auto* node = reinterpret_cast<FreeNode*>(chunk + (i - 1) * block_size_);
+    node->next = free_list_;
+    free_list_ = node;
+  }
+}
+
+void FixedBlockPool::ReleaseChunks() {
+  for (void* chunk : chunks_) {
+    ::operator delete(chunk, std::align_val_t(block_align_));
+  }
+  chunks_.clear();
+  chunks_.shrink_to_fit();
+  free_list_ = nullptr;
+}
+
+}  // namespace engine::utils
@@ -0,0 +1,61 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace engine::utils {
+
+/**
+ * @brief 定长内存块池。
+ * 一次向系统申请一整块（blocks_per_chunk 个块），空闲块用侵入式链表串起来，
+ * 分配和释放都是 O(1) 的指针操作。稳定运行后反复创建/销毁同类对象不会再触发全局堆分配。
+ * 非线程安全：不要求固定在某个线程，但同一时刻只能有一个线程使用。流水线模式下对象和组件的增删
+ * 在模拟线程上进行，场景切换在同步点的主线程上进行，两者不会重叠。调试构建下会断言没有并发调用。
+ */
+class FixedBlockPool final {
+ public:
+  FixedBlockPool(size_t block_size, size_t block_align, size_t blocks_per_chunk);
+  ~FixedBlockPool();
+
+  // 禁止拷贝和移动
+  FixedBlockPool(const FixedBlockPool&) = delete;
+  FixedBlockPool& operator=(const FixedBlockPool&) = delete;
+  FixedBlockPool(FixedBlockPool&&) = delete;
+  FixedBlockPool& operator=(FixedBlockPool&&) = delete;
+
+  [[nodiscard]] void* Allocate();
+  void Deallocate(void* block);
+
+  // 没有存活的块时把所有内存整体还给系统，返回是否释放
+  bool ReleaseIfUnused();
+
+  [[nodiscard]] size_t GetBlockSize() const {
+    return block_size_;
+  }
+  [[nodiscard]] size_t GetLiveCount() const {
+    return live_count_;
+  }
+  [[nodiscard]] size_t GetCapacity() const {
+    return chunks_.size() * blocks_per_chunk_;
+  }
+
+ private:
+  struct FreeNode {
+    FreeNode* next;
+  };
+
+  void AllocateChunk();
+  void ReleaseChunks();
+
+  size_t block_size_;
+  size_t block_align_;
+  size_t blocks_per_chunk_;
+  std::vector<void*> chunks_;
+  FreeNode* free_list_ = nullptr;
+  size_t live_count_ = 0;
+#ifndef NDEBUG
+  std::atomic<bool> is_in_use_{false};  // 检测并发调用
+#endif
+};
+
+}  // namespace engine::utils
@@ -0,0 +1,145 @@
+#include "profiler.h"
+#include <SDL3/SDL_timer.h>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "logger.hpp"
+
+namespace engine::utils {
+namespace {
+DECLARE_TAG(Profiler)
+
+struct ProfileEvent {
+  const char* name = nullptr;
+  uint64_t begin_ticks = 0;
+  uint64_t end_ticks = 0;
+};
+
+struct ThreadBuffer {
+  std::unique_ptr<ProfileEvent[]> events = std::make_unique<ProfileEvent[]>(Profiler::kEventsPerThread);
+  std::atomic<uint64_t> write_count{0};
+  uint32_t thread_id = 0;
+  std::string thread_name;  // 受 Registry::mutex 保护
+};
+
+/**
+ * @brief 所有线程缓冲的登记表。缓冲由这里持有，线程退出后记录仍可导出。
+ */
+struct Registry {
+  std::mutex mutex;
+  std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+  // 计时基准：同时记录一次时间戳和 SDL 性能计数器，导出时据此换算
+  uint64_t base_ticks = Profiler::Now();
+  uint64_t base_counter = SDL_GetPerformanceCounter();
+};
+
+Registry& GetRegistry() {
+  static Registry registry;
+  return registry;
+}
+
+thread_local ThreadBuffer* tls_buffer = nullptr;
+
+ThreadBuffer& GetThreadBuffer() {
+  if (tls_buffer == nullptr) {
+    auto& registry = GetRegistry();
+    std::lock_guard lock(registry.mutex);
+    auto buffer = std::make_unique<ThreadBuffer>();
+    buffer->thread_id = static_cast<uint32_t>(registry.buffers.size()) + 1;
+    tls_buffer = buffer.get();
+    registry.buffers.push_back(std::move(buffer));
+  }
+  return *tls_buffer;
+}
+
+// 把线程名里可能出现的引号和反斜杠转义，区间名都是代码里的字面量，不做处理
+std::string EscapeJson(const std::string& text) {
+  std::string escaped;
+  escaped.reserve(text.size());
+  for (const char c : text) {
+    if (c == '"' || c == '\\') {
+      escaped.push_back('\\');
+    }
+    escaped.push_back(c);
+  }
+  return escaped;
+}
+}  // namespace
+
+void Profiler::Record(const char* name, uint64_t begin_ticks, uint64_t end_ticks) {
+  auto& buffer = GetThreadBuffer();
+  const uint64_t index = buffer.write_count.load(std::memory_order_relaxed);
+  buffer.events[index & (kEventsPerThread - 1)] = {name, begin_ticks, end_ticks};
+  buffer.write_count.store(index + 1, std::memory_order_release);
+}
+
+void Profiler::SetThreadName(const std::string& name) {
+  auto& buffer = GetThreadBuffer();
+  std::lock_guard lock(GetRegistry().mutex);
+  buffer.thread_name = name;
+}
+
+bool Profiler::DumpChromeTrace(const std::string& file_path) {
+  auto& registry = GetRegistry();
+  std::lock_guard lock(registry.mutex);
+
+  // 用导出时刻再采一次，得到时间戳到微秒的换算系数
+  const uint64_t elapsed_ticks = Now() - registry.base_ticks;
+  const uint64_t elapsed_counter = SDL_GetPerformanceCounter() - registry.base_counter;
+  const double elapsed_us =
+      static_cast<double>(elapsed_counter) * 1'000'000.0 / static_cast<double>(SDL_GetPerformanceFrequency());
+  if (elapsed_ticks == 0 || elapsed_us <= 0.0) {
+    LOGW(TAG, "Profiler clock has not advanced yet, nothing to dump");
+    return false;
+  }
+  const double us_per_tick = elapsed_us / static_cast<double>(elapsed_ticks);
+
+  std::ofstream file(file_path);
+  if (!file.is_open()) {
+    LOGE(TAG, "Failed to open trace file: {}", file_path);
+    return false;
+  }
+
+  // ts 是从基准开始的微秒数，默认的 6 位有效数字在几秒后就不够用了
+  file << std::fixed << std::setprecision(3);
+  file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  bool is_first = true;
+  size_t event_count = 0;
+  for (const auto& buffer : registry.buffers) {
+    const std::string thread_name =
+        buffer->thread_name.empty() ? "Thread " + std::to_string(buffer->thread_id) : buffer->thread_name;
+    file << (is_first ? "" : ",") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->thread_id
+         << ",\"args\":{\"name\":\"" << EscapeJson(thread_name) << "\"}}";
+    is_first = false;
+
+    const uint64_t write_count = buffer->write_count.load(std::memory_order_acquire);
+    const uint64_t first = write_count > kEventsPerThread ? write_count - kEventsPerThread : 0;
+    for (uint64_t i = first; i < write_count; ++i) {
+      const ProfileEvent& event = buffer->events[i & (kEventsPerThread - 1)];
+      if (event.name == nullptr || event.end_ticks < event.begin_ticks || event.begin_ticks < registry.base_ticks) {
+        continue;
+      }
+      const double ts = static_cast<double>(event.begin_ticks - registry.base_ticks) * us_per_tick;
+      const double dur = static_cast<double>(event.end_ticks - event.begin_ticks) * us_per_tick;
+      file << ",{\"name\":\"" << event.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->thread_id
+           << ",\"ts\":" << ts << ",\"dur\":" << dur << "}";
+      ++event_count;
+    }
+  }
+  file << "]}\n";
+
+  if (!file.good()) {
+    LOGE(TAG, "Failed to write trace file: {}", file_path);
+    return false;
+  }
+  LOGI(TAG, "Dumped {} profile events from {} thread(s) to {}", event_count, registry.buffers.size(), file_path);
+  return true;
+}
+
+uint64_t Profiler::ReadPerformanceCounter() {
+  return SDL_GetPerformanceCounter();
+}
+
+}  // namespace engine::utils
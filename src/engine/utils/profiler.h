@@ -0,0 +1,89 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define SUNNYLAND_PROFILER_HAS_RDTSC 1
+#elif defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#define SUNNYLAND_PROFILER_HAS_RDTSC 1
+#endif
+
+namespace engine::utils {
+
+/**
+ * @brief 低开销的区间采样器。
+ * 每个线程第一次记录时分配自己的环形缓冲，记录一个区间只是两次读时间戳加一次写入，不加锁、不格式化、不分配。
+ * 缓冲满了覆盖最旧的数据，所以任意时刻都能导出最近一段时间的记录（Chrome trace_event JSON，
+ * 用 chrome://tracing 或 Perfetto 打开）。
+ * x86 上用 rdtsc 计时，导出时对照 SDL 性能计数器换算成微秒；其他平台直接用 SDL 性能计数器。
+ */
+class Profiler final {
+ public:
+  static constexpr size_t kEventsPerThread = size_t{1} << 16;
+
+  static void SetEnabled(bool enabled) {
+    is_enabled_.store(enabled, std::memory_order_relaxed);
+  }
+  [[nodiscard]] static bool IsEnabled() {
+    return is_enabled_.load(std::memory_order_relaxed);
+  }
+
+  [[nodiscard]] static uint64_t Now() {
+#ifdef SUNNYLAND_PROFILER_HAS_RDTSC
+    return __rdtsc();
+#else
+    return ReadPerformanceCounter();
+#endif
+  }
+
+  // name 必须是静态生命周期的字符串（通常是字面量），导出时才读取
+  static void Record(const char* name, uint64_t begin_ticks, uint64_t end_ticks);
+  // 导出时显示的线程名，未设置时为 "Thread N"
+  static void SetThreadName(const std::string& name);
+  // 导出所有线程缓冲中的记录，最好在帧与帧之间调用，正在写入的几条记录可能不完整
+  static bool DumpChromeTrace(const std::string& file_path);
+
+ private:
+  static uint64_t ReadPerformanceCounter();
+
+  static inline std::atomic<bool> is_enabled_{true};
+};
+
+/**
+ * @brief RAII 区间：构造时记开始时间，析构时写入所在线程的缓冲。
+ */
+class ProfileScope final {
+ public:
+  explicit ProfileScope(const char* name) : name_(name), begin_ticks_(Profiler::IsEnabled() ? Profiler::Now() : 0) {
+  }
+  ~ProfileScope() {
+    if (begin_ticks_ != 0) {
+      Profiler::Record(name_, begin_ticks_, Profiler::Now());
+    }
+  }
+
+  // 禁止拷贝和移动
+  ProfileScope(const ProfileScope&) = delete;
+  ProfileScope& operator=(const ProfileScope&) = delete;
+  ProfileScope(ProfileScope&&) = delete;
+  ProfileScope& operator=(ProfileScope&&) = delete;
+
+ private:
+  const char* name_;
+  uint64_t begin_ticks_;
+};
+
+}  // namespace engine::utils
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+// 构建时定义 SUNNYLAND_DISABLE_PROFILER 可把所有区间完全编译掉
+#ifdef SUNNYLAND_DISABLE_PROFILER
+#define PROFILE_SCOPE(name) ((void)0)
+#else
+#define PROFILE_SCOPE(name) ::engine::utils::ProfileScope PROFILE_CONCAT(profile_scope_, __LINE__)(name)
+#endif
@@ -0,0 +1,57 @@
+#include "string_id.h"
+
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+namespace engine::utils {
+namespace {
+// 支持用 string_view 直接查 unordered_map<std::string, ...>，查找时不构造临时字符串
+struct TransparentStringHash {
+  using is_transparent = void;
+  size_t operator()(std::string_view str) const noexcept {
+    return std::hash<std::string_view>{}(str);
+  }
+};
+
+struct StringTable {
+  std::mutex mutex;
+  std::deque<std::string> strings{std::string()};  // deque 追加不会使已有元素的引用失效
+  std::unordered_map<std::string, uint32_t, TransparentStringHash, std::equal_to<>> ids{{std::string(), 0}};
+};
+
+StringTable& GetStringTable() {
+  static StringTable table;
+  return table;
+}
+}  // namespace
+
+StringId StringId::Find(std::string_view str) {
+  auto& table = GetStringTable();
+  std::lock_guard lock(table.mutex);
+  StringId result;
+  if (const auto it = table.ids.find(str); it != table.ids.end()) {
+    result.id_ = it->second;
+  }
+  return result;
+}
+
+const std::string& StringId::GetString() const {
+  auto& table = GetStringTable();
+  std::lock_guard lock(table.mutex);
+  return table.strings[id_];
+}
+
+uint32_t StringId::Intern(std::string_view str) {
+  auto& table = GetStringTable();
+  std::lock_guard lock(table.mutex);
+  if (const auto it = table.ids.find(str); it != table.ids.end()) {
+    return it->second;
+  }
+  const auto id = static_cast<uint32_t>(table.strings.size());
+  table.strings.emplace_back(str);
+  table.ids.emplace(table.strings.back(), id);
+  return id;
+}
+
+}  // namespace engine::utils
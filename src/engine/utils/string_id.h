@@ -0,0 +1,46 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace engine::utils {
+
+/**
+ * @brief 驻留字符串 id。
+ * 相同内容的字符串全局只保存一份，比较和哈希都只涉及一个整数。
+ * 0 号保留给空字符串，表示“未设置”。驻留表只增不减，适合名字、标签这类有限集合，不要用于任意文本。
+ */
+class StringId final {
+ public:
+  StringId() = default;
+  explicit StringId(std::string_view str) : id_(Intern(str)) {
+  }
+
+  // 只查询不驻留：字符串从未出现过时返回空 id，用于查找时避免让驻留表无限增长
+  [[nodiscard]] static StringId Find(std::string_view str);
+
+  [[nodiscard]] uint32_t GetValue() const {
+    return id_;
+  }
+  [[nodiscard]] bool IsEmpty() const {
+    return id_ == 0;
+  }
+  [[nodiscard]] const std::string& GetString() const;
+
+  friend bool operator==(StringId, StringId) = default;
+
+ private:
+  static uint32_t Intern(std::string_view str);
+
+  uint32_t id_ = 0;
+};
+
+}  // namespace engine::utils
+
+template <>
+struct std::hash<engine::utils::StringId> {
+  size_t operator()(engine::utils::StringId id) const noexcept {
+    return std::hash<uint32_t>{}(id.GetValue());
+  }
+};
@@ -5,18 +5,26 @@
 #include "core/context.h"
 #include "logger.hpp"
 #include "object/game_object.h"
+#include "resource/async_loader.h"
+#include "scene/level_loader.h"
 
 namespace game::scene {
 namespace {
 DECLARE_TAG(GameScene)
+constexpr const char* kLevelPath = "assets/maps/level1.tmj";
+constexpr const char* kTestObjectTexture = "assets/textures/Props/big-crate.png";
 }  // namespace
 GameScene::GameScene(const std::string& name, engine::core::Context& context,
-                     engine::scene::SceneManager& scene_manager)
-    : Scene(name, context, scene_manager) {
+                     engine::scene::SceneManager& scene_manager, std::string level_path)
+    : Scene(name, context, scene_manager), level_path_(level_path.empty() ? kLevelPath : std::move(level_path)),
+      level_loader_(std::make_shared<engine::scene::LevelLoader>()) {
   LOGT(TAG, "GameScene constructor");
 }
 
 void GameScene::Init() {
+  if (!level_loader_->LoadLevel(level_path_, *this)) {
+    LOGE(TAG, "Failed to load level!");
+  }
   CreateTestObject();
 
   Scene::Init();
@@ -39,13 +47,24 @@ void GameScene::Clean() {
   Scene::Clean();
 }
 
+std::function<engine::resource::PreloadSet()> GameScene::GetPreloadCollector() const {
+  // 在加载线程上执行：读取并解析关卡文件，收集纹理路径
+  return [level_loader = level_loader_, level_path = level_path_]() {
+    engine::resource::PreloadSet preload_set;
+    if (!level_loader->CollectTexturePaths(level_path, preload_set.textures)) {
+      LOGW(TAG, "Failed to collect level textures, they will be loaded on demand");
+    }
+    preload_set.textures.emplace_back(kTestObjectTexture);
+    return preload_set;
+  };
+}
+
 void GameScene::CreateTestObject() {
   LOGT(TAG, "Create test_object...");
   auto test_object = std::make_unique<engine::object::GameObject>("test_object");
 
   test_object->AddComponent<engine::component::TransformComponent>(glm::vec2(100.0f, 100.0f));
-  test_object->AddComponent<engine::component::SpriteComponent>(
-      "D:/workspace/SunnyLand/assets/textures/Props/big-crate.png", context_.GetResourceManager());
+  test_object->AddComponent<engine::component::SpriteComponent>(kTestObjectTexture, context_.GetResourceManager());
 
   AddGameObject(std::move(test_object));
   LOGT(TAG, "test_object created and added to GameScene.");
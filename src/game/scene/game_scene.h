@@ -1,26 +1,36 @@
 #pragma once
 #include <memory>
+#include <string>
 #include "scene/scene.h"
 
 namespace engine::object {
 class GameObject;
 }  // namespace engine::object
 
+namespace engine::scene {
+class LevelLoader;
+}  // namespace engine::scene
+
 namespace game::scene {
 
 class GameScene final : public engine::scene::Scene {
  public:
   explicit GameScene(const std::string& name, engine::core::Context& context,
-                     engine::scene::SceneManager& scene_manager);
+                     engine::scene::SceneManager& scene_manager, std::string level_path = {});
 
   void Init() override;
   void Update(double delta_time_s) override;
   void Render() override;
   void HandleInput() override;
   void Clean() override;
+  [[nodiscard]] std::function<engine::resource::PreloadSet()> GetPreloadCollector() const override;
 
  private:
   void CreateTestObject();
+
+  std::string level_path_;  // 构造时传空则使用默认关卡
+  // 预加载任务在加载线程上用它解析关卡，Init 复用解析结果；共享所有权保证场景先销毁时任务仍可安全结束
+  std::shared_ptr<engine::scene::LevelLoader> level_loader_;
 };
 
 }  // namespace game::scene
\ No newline at end of file
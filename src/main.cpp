@@ -1,8 +1,32 @@
 #include "engine/core/game_app.h"
+#include "engine/core/launch_options.h"
+#include "engine/utils/async_log_sink.h"
 
+#include <spdlog/sinks/stdout_color_sinks.h>
+#include <cstdlib>
 #include "logger.hpp"
-int main(int, char**) {
+int main(int argc, char** argv) {
+  engine::core::LaunchOptions options;
+  if (!engine::core::LaunchOptions::Parse(argc, argv, options)) {
+    return EXIT_FAILURE;
+  }
+  // 日志经异步 sink 交给后台线程输出，游戏线程只做入队；默认 logger 的名字和格式保持不变。
+  // 基准测试的报告可能直接打印到标准输出，这时日志改走标准错误，方便流水线解析报告
+  spdlog::sink_ptr console_sink;
+  if (options.IsBenchmark()) {
+    console_sink = std::make_shared<spdlog::sinks::stderr_color_sink_mt>();
+  } else {
+    console_sink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
+  }
+  auto async_sink = std::make_shared<engine::utils::AsyncLogSink>(std::vector<spdlog::sink_ptr>{console_sink});
+  spdlog::set_default_logger(std::make_shared<spdlog::logger>("", async_sink));
   spdlog::set_level(spdlog::level::trace);
-  engine::core::GameApp game;
-  game.Run();
+  int exit_code = EXIT_SUCCESS;
+  {
+    engine::core::GameApp game(std::move(options));
+    exit_code = game.Run();
+  }
+  // 退出前把队列里剩下的日志写完
+  spdlog::shutdown();
+  return exit_code;
 }